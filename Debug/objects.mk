@@ -1,4 +1,3 @@
-<<<<<<< HEAD
 ################################################################################
 # Automatically-generated file. Do not edit!
 ################################################################################
@@ -7,13 +6,3 @@ USER_OBJS :=
 
 LIBS := -lm -lc -lgcc
 
-=======
-################################################################################
-# Automatically-generated file. Do not edit!
-################################################################################
-
-USER_OBJS :=
-
-LIBS := -lm -lc -lgcc
-
->>>>>>> edc6387c1d585a5baaf460e549f88eece77f0548
@@ -1,4 +1,3 @@
-<<<<<<< HEAD
 ################################################################################
 # Automatically-generated file. Do not edit!
 ################################################################################
@@ -24,30 +23,3 @@ C_DEPS :=
 SUBDIRS := \
 src \
 
-=======
-################################################################################
-# Automatically-generated file. Do not edit!
-################################################################################
-
-OBJ_SRCS := 
-S_SRCS := 
-ASM_SRCS := 
-C_SRCS := 
-S_UPPER_SRCS := 
-O_SRCS := 
-FLASH_IMAGE := 
-ELFS := 
-OBJS := 
-ASM_DEPS := 
-EEPROM_IMAGE := 
-S_DEPS := 
-SIZEDUMMY := 
-S_UPPER_DEPS := 
-LSS := 
-C_DEPS := 
-
-# Every subdirectory with source files must be described here
-SUBDIRS := \
-src \
-
->>>>>>> edc6387c1d585a5baaf460e549f88eece77f0548
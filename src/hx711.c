@@ -1,35 +1,475 @@
-<<<<<<< HEAD
 /******************************************************************************
- *
  * HX711 library for AVR ATmega328P - Implementation
- * With Proteus simulation support
- * Optimized for 1MHz clock frequency
+ * With optional Proteus / software simulation support
+ * Optimized for ~1 MHz CPU clock
  *
  ******************************************************************************/
 
 #include "hx711.h"
+#include <math.h>
+#if HX711_SIM_HOST_FILE
+#include <stdio.h>
+#include <stdlib.h>
+#endif
 
 /*---------------------------------------------------------------------------------
  * STATIC VARIABLES
- *---------------------------------------------------------------------------------*/
-static uint8 g_gain = 1;            // Gain pulses (1=128, 3=64, 2=32)
-static sint32 g_offset = 0;         // Tare offset
-static double g_scale = 1.0;        // Scale factor
-static uint8 g_gainValue = 128;     // Actual gain value for getgain()
+ *--------------------------------------------------------------------------------*/
+static uint8  g_gain       = 1;      /* pulses count: 1=128, 3=64, 2=32        */
+static sint32 g_offset     = 0;      /* tare offset                             */
+static double g_scale      = 1.0;    /* scale factor (counts per kg)           */
+static sint32 g_scaleRecip = 0;      /* grams per count, Q32 (see hx711.h)     */
+static uint8  g_gainValue  = 128;    /* actual gain value for getgain()        */
+
+/* Tare behaviour of hx711_taretozero() */
+static HX711_TareMode_t g_tareMode = HX711_TARE_MODE_DEFAULT;
+
+/* Outcome of the last tare/calibration average */
+static HX711_AverageResult_t g_lastAverage = {0, 0, 0, 0};
+
+/* Last sample the blocking reads obtained, repeated when one times out */
+static sint32 g_lastRaw = 0;
+
+/* Multi-point calibration table: tared counts ascending, (0, 0) included */
+static sint32 g_calCounts[HX711_CAL_MAX_POINTS + 1];
+static sint32 g_calGrams[HX711_CAL_MAX_POINTS + 1];
+static sint32 g_calSlope[HX711_CAL_MAX_POINTS];   /* Q32 g/count, entry i to i+1 */
+static uint8  g_calCount = 0;                     /* 0 = single scale in use    */
+
+/* Simulation state - uses counter instead of millis() */
+static uint8  g_simulationEnabled = HX711_SIMULATION_ENABLED_DEFAULT;
+static uint8  g_simPatternActive  = 0;
+static uint32 g_simTicksMs        = 0;  /* incremented on each simulated read */
+
+/* Simulation sources beyond the built-in pattern */
+#define HX711_SIM_SOURCE_PATTERN   0U
+#define HX711_SIM_SOURCE_TRACE     1U
+#define HX711_SIM_SOURCE_SCENARIO  2U
+
+static uint8  g_simSource      = HX711_SIM_SOURCE_PATTERN;
+static const uint8 *g_simTrace = NULL;
+static uint16 g_simTraceLength = 0;
+static uint16 g_simTracePos    = 0;
+static sint32 g_simTraceRaw    = 0;     /* last replayed sample             */
+static uint8  g_simTraceLoop   = 0;
+static uint8  g_simFinished    = 0;     /* non-looping trace ran out        */
+static HX711_Scenario_t g_simScenario;
+static uint32 g_simRng         = 1;     /* xorshift32 state, reseeded per run */
+#if HX711_SIM_HOST_FILE
+static uint8  g_simFileBuffer[HX711_SIM_FILE_BUFFER_BYTES];
+#endif
+
+/* Streaming filter state */
+static HX711_FilterType_t g_filterType = HX711_FILTER_NONE;
+static uint8  g_filterPrimed  = 0;      /* at least one sample fed since reset */
+static sint32 g_filteredRaw   = 0;      /* latest filter output (raw counts)   */
+
+static sint32 g_avgWindow[HX711_FILTER_AVG_WINDOW];
+static sint32 g_avgSum        = 0;
+static uint8  g_avgIndex      = 0;
+
+static sint32 g_medianWindow[HX711_FILTER_MEDIAN_SIZE];  /* arrival order */
+static sint32 g_medianSorted[HX711_FILTER_MEDIAN_SIZE];  /* ascending     */
+static uint8  g_medianIndex   = 0;
+
+static sint32 g_iirAcc        = 0;      /* y scaled by 2^HX711_FILTER_IIR_SHIFT */
+
+static sint32 g_adaptAcc      = 0;      /* y scaled by 2^HX711_ADAPTIVE_MAX_SHIFT */
+static uint8  g_adaptShift    = 0;      /* current weight is 1/2^shift          */
+static uint8  g_adaptSettled  = 0;      /* samples since the last step          */
+static sint32 g_adaptStep     = 0;      /* step threshold in counts             */
+
+/* Outlier rejection state */
+static uint8  g_outlierEnabled = 0;
+static sint32 g_outlierWindow[HX711_OUTLIER_WINDOW];  /* raw, arrival order */
+static uint8  g_outlierIndex   = 0;
+static uint8  g_outlierCount   = 0;     /* valid entries in the window        */
+static sint32 g_outlierFloor   = 0;     /* minimum threshold in counts        */
+static uint16 g_outlierRejected = 0;
+
+/* Mains notch (comb) state */
+typedef struct
+{
+    sint32 window[HX711_NOTCH_LENGTH];
+    sint32 sum;
+    uint8  index;
+    uint8  primed;
+} HX711_Notch_t;
+
+static uint8         g_notchEnabled = 0;
+static HX711_Notch_t g_notch;
+
+/* Oversampling / decimation state */
+static uint8  g_decimateLog2  = 0;      /* 0 = stage off                     */
+static sint32 g_decimateAcc   = 0;
+static uint8  g_decimateCount = 0;
+static sint32 g_decimated     = 0;      /* raw << (log2 / 2)                 */
+static uint8  g_decimatedReady = 0;
+
+/* Kalman state: weight in 1/16 count, rate in 1/65536 count per sample,
+ * covariances / measurement variance in Q24 */
+static sint32 g_kalWeight   = 0;
+static sint32 g_kalRate     = 0;
+static sint32 g_kalP00      = 0;
+static sint32 g_kalP01      = 0;
+static sint32 g_kalP11      = 0;
+static sint32 g_kalQWeight  = HX711_KALMAN_Q24(HX711_KALMAN_WEIGHT_SIGMA_UG);
+static sint32 g_kalQRate    = HX711_KALMAN_Q24(HX711_KALMAN_RATE_SIGMA_UG);
+static uint16 g_kalMeasMg   = HX711_KALMAN_MEAS_SIGMA_MG;
+static sint64 g_kalGateSq   = 0;        /* gate^2 * R, counts^2             */
+
+/* Stability detection state */
+static sint32 g_stableWindow[HX711_STABLE_WINDOW];
+static uint8  g_stableIndex      = 0;
+static uint8  g_stableCount      = 0;   /* valid entries in the window        */
+static sint32 g_stableThreshold  = 0;   /* max peak-to-peak in counts         */
+static uint8  g_isStable         = 0;
+static uint8  g_stableLatched    = 0;
+static sint32 g_stableLatchedRaw = 0;   /* filtered raw when stability began  */
+
+/* Fault detection state */
+static volatile uint8 g_railCount = 0;  /* rail conversions in a row (routing) */
+static uint16 g_noDataMs       = 0;     /* time waited without data            */
+static sint32 g_stableSpread   = 0;     /* last peak-to-peak, counts           */
+static sint32 g_faultNoiseBand = 0;     /* counts, derived from the scale      */
+static uint8  g_noisyCount     = 0;
+
+/* Settling prediction state */
+static sint32 g_predBlockSum   = 0;
+static uint8  g_predBlockCount = 0;
+static sint32 g_predMeans[3];           /* oldest first                    */
+static uint8  g_predMeanCount  = 0;
+static sint32 g_predRaw        = 0;     /* latest predicted final raw      */
+static uint8  g_predConfident  = 0;
+static uint8  g_predAgreeRun   = 0;     /* fits in a row within the band   */
+static sint32 g_predAgree      = 0;     /* agreement band in counts        */
+
+/* Automatic zero tracking state */
+static uint8  g_zeroTrackEnabled = 0;
+static sint32 g_zeroReference    = 0;   /* calibrated offset tracking is bound to */
+static sint32 g_zeroTrackWindow  = 0;   /* counts, derived from the scale         */
+static sint32 g_zeroTrackLimit   = 0;   /* counts, derived from the scale         */
+
+#if HX711_MULTI_CELL_ENABLED
+/* Multi-load-cell platform state */
+static const uint8 g_cellPinNum[HX711_MULTI_CELL_COUNT] = HX711_MULTI_DOUT_PINNUMS;
+static uint8  g_cellMask = 0;           /* DOUT bits of every cell          */
+static sint32 g_cellRaw[HX711_MULTI_CELL_COUNT];     /* latest conversion  */
+static sint32 g_cellOffset[HX711_MULTI_CELL_COUNT];
+static sint32 g_cellRecip[HX711_MULTI_CELL_COUNT];   /* Q32 grams per count */
+#endif
+
+#if HX711_INTERLEAVE_ENABLED
+/* Channel A/B scheduler: runs in whichever context shifts samples in */
+static volatile uint8 g_interleaveActive = 0;
+static uint8  g_convChannel       = HX711_CHANNEL_A;  /* conversion in progress   */
+static uint8  g_interleaveRun     = 0;  /* conversions in the current run          */
+static uint8  g_interleaveSettling = 0; /* conversion in progress follows a switch */
+static uint8  g_sampleTag         = HX711_CHANNEL_A;  /* last sample shifted in   */
+
+/* Channel B queue: SPSC like the acquisition ring below */
+static volatile sint32 g_channelBBuffer[HX711_CHANNEL_B_BUFFER_SIZE];
+static volatile uint8  g_channelBHead = 0;
+static volatile uint8  g_channelBTail = 0;
+#endif
+
+#if HX711_ISR_ACQUISITION_ENABLED
+/* Interrupt-driven acquisition: SPSC ring buffer (ISR produces, main consumes) */
+static volatile sint32 g_sampleBuffer[HX711_SAMPLE_BUFFER_SIZE];
+static volatile uint8  g_sampleHead      = 0;  /* written by ISR only          */
+static volatile uint8  g_sampleTail      = 0;  /* written by consumer only     */
+static volatile uint8  g_sampleOverruns  = 0;  /* samples dropped, buffer full */
+static volatile uint8  g_acquisitionActive = 0;
+#endif
+
+/* Idle power management: the count advances wherever samples are routed */
+static volatile uint8 g_poweredDown = 0;
+#if HX711_AUTO_POWERDOWN_ENABLED
+static volatile uint16 g_idleSamples = 0;
+static uint16 g_idleLimit     = 0;      /* samples, 0 = no auto powerdown   */
+static volatile uint8 g_warmupDiscard = 0;
+#endif
+
+/* Sample timing: Timer1 stamps of routed conversions */
+static volatile uint8 g_timingResync = 1; /* next conversion only sets the stamp */
+#if HX711_TIMING_ENABLED
+static uint8  g_timingActive    = 0;
+static uint16 g_lastStamp       = 0;    /* TCNT1 of the newest conversion  */
+static uint16 g_intervalMin     = 0xFFFFU;
+static uint16 g_intervalMax     = 0;
+static uint32 g_intervalSum     = 0;
+static uint16 g_intervalCount   = 0;
+static uint16 g_missedSamples   = 0;
+#if HX711_ISR_ACQUISITION_ENABLED
+static volatile uint16 g_sampleStamp[HX711_SAMPLE_BUFFER_SIZE];
+#endif
+#endif
+
+#if HX711_AUTORANGE_ENABLED
+/* Gain auto-ranging: pulse tracking runs wherever samples are shifted in */
+#define HX711_PULSES_A128               1U  /* trailing pulses: channel A, 128 */
+#define HX711_PULSES_A64                3U  /* trailing pulses: channel A, 64  */
+
+/* Gain 128 counts per gain 64 count, Q16: nominal and accepted range */
+#define HX711_AUTORANGE_NOMINAL_RATIO   (2L << 16)
+#define HX711_AUTORANGE_MIN_RATIO       (1L << 16)
+#define HX711_AUTORANGE_MAX_RATIO       (4L << 16)
+
+/* Mapped samples are held to HX711_SAMPLE_BITS signed */
+#define HX711_MAPPED_MAX                ((1L << (HX711_SAMPLE_BITS - 1)) - 1L)
+#define HX711_MAPPED_MIN                (-(1L << (HX711_SAMPLE_BITS - 1)))
 
+static volatile uint8 g_autoRange = 0;
+static uint8  g_convPulses      = 1;    /* gain pulses of the conversion in progress */
+static uint8  g_samplePulses    = 1;    /* gain pulses of the last sample shifted in */
+static uint8  g_rangeSwitched   = 0;    /* conversion in progress follows a switch   */
+static uint8  g_rangeSettling   = 0;    /* last sample shifted in is settling        */
+static sint32 g_rangeRatio      = HX711_AUTORANGE_NOMINAL_RATIO;  /* Q16          */
+static sint32 g_rangeBias       = 0;    /* gain 128 value of a 0 gain 64 reading     */
+static double g_lowGainScale    = 0.0;  /* counts per kg at gain 64, 0 = none        */
+static sint32 g_lowGainOffset   = 0;    /* raw zero at gain 64                       */
+static sint32 g_lowGainZero     = 0;    /* raw zero at gain 128 taken with it        */
+#endif
+
+#if HX711_RECORDER_ENABLED
+/* Raw sample recorder: byte ring in trace format (see hx711.h) */
+#define HX711_RECORDER_MASK        ((uint8)(HX711_RECORDER_BYTES - 1U))
+#define HX711_RECORDER_HEADER      12U
+
+static uint8  g_recRing[HX711_RECORDER_BYTES];
+static uint8  g_recHead      = 0;
+static uint8  g_recTail      = 0;
+static uint16 g_recUsed      = 0;
+static uint8  g_recEnabled   = 0;
+static uint32 g_recTick      = 0;       /* conversions routed so far         */
+static uint32 g_recLastTick  = 0;       /* tick of the newest record         */
+static sint32 g_recLastRaw   = 0;       /* value of the newest record        */
+static uint32 g_recBaseTick  = 0;       /* tick before the oldest record     */
+static sint32 g_recBaseRaw   = 0;       /* value before the oldest record    */
+static volatile uint8  g_recDumping = 0;
+static uint8  g_dumpHeader[HX711_RECORDER_HEADER];
+static volatile uint16 g_dumpIndex  = 0;
+static uint16 g_dumpLength   = 0;       /* header + records                  */
+#endif
 
 /*---------------------------------------------------------------------------------
- * PRIVATE MACROS (for real hardware)
- *---------------------------------------------------------------------------------*/
-#define HX711_SCK_HIGH()    SET_BIT(HX711_SCK_PORT, HX711_SCK_PINNUM)
-#define HX711_SCK_LOW()     CLEAR_BIT(HX711_SCK_PORT, HX711_SCK_PINNUM)
-#define HX711_DOUT_READ()   ((HX711_DOUT_PIN >> HX711_DOUT_PINNUM) & 0x01)
-#define HX711_PULSE_DELAY_US 2
+ * PRIVATE MACROS (REAL HARDWARE)
+ *--------------------------------------------------------------------------------*/
+#define HX711_SCK_HIGH()  SET_BIT(HX711_SCK_PORT, HX711_SCK_PINNUM)
+#define HX711_SCK_LOW()   CLEAR_BIT(HX711_SCK_PORT, HX711_SCK_PINNUM)
+#define HX711_DOUT_READ() ((HX711_DOUT_PIN >> HX711_DOUT_PINNUM) & 0x01)
+
+#define HX711_PULSE_DELAY_US   2
+#define HX711_DATA_BITS        24U
+
+/* Saturation codes, sign-extended */
+#define HX711_RAW_MAX          0x007FFFFFL
+#define HX711_RAW_MIN          (-0x00800000L)
+
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+/* Master, mode 1 (sample on falling edge), MSB first, F_CPU/2 */
+#define HX711_SPI_SPCR   ((1U << SPE) | (1U << MSTR) | (1U << CPHA))
+#define HX711_SPI_SPSR   (1U << SPI2X)
+#endif
+
+#if HX711_BENCHMARK_ENABLED
+static uint16 g_benchIrqOffStart = 0;
+static uint16 g_benchIrqOffMax   = 0;
+static uint8  g_benchHold        = 0;   /* benchmark read: schedule suspended */
+
+#define HX711_BENCH_IRQOFF_BEGIN()  (g_benchIrqOffStart = TCNT1)
+#define HX711_BENCH_IRQOFF_END()                                   \
+    do {                                                           \
+        uint16 span = (uint16)(TCNT1 - g_benchIrqOffStart);        \
+        if(span > g_benchIrqOffMax) { g_benchIrqOffMax = span; }   \
+    } while(0)
+#else
+#define HX711_BENCH_IRQOFF_BEGIN()
+#define HX711_BENCH_IRQOFF_END()
+#endif
+
+/*
+ * Interrupt policy around one readout. Bit-banged transfers must not be
+ * stretched (SCK high > 60 us powers the HX711 down), so they run fully
+ * masked. The SPI transport masks only the individual gain pulses. The
+ * caller's interrupt state is restored afterwards; readouts never nest, so
+ * one saved SREG is enough.
+ */
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+#define HX711_READ_CRITICAL_BEGIN()
+#define HX711_READ_CRITICAL_END()
+#else
+/* Written only after cli(), so a read in the ISR cannot clobber it */
+static uint8 g_readSreg = 0;
+
+#define HX711_READ_CRITICAL_BEGIN()                                \
+    do {                                                           \
+        uint8 readSreg = SREG;                                     \
+        cli();                                                     \
+        g_readSreg = readSreg;                                     \
+        HX711_BENCH_IRQOFF_BEGIN();                                \
+    } while(0)
+#define HX711_READ_CRITICAL_END()                                  \
+    do {                                                           \
+        HX711_BENCH_IRQOFF_END();                                  \
+        SREG = g_readSreg;                                         \
+    } while(0)
+#endif
+
+#if ((HX711_FILTER_MEDIAN_SIZE & 1U) == 0) || (HX711_FILTER_AVG_WINDOW_LOG2 > (31 - HX711_SAMPLE_BITS))
+#error "HX711_FILTER_MEDIAN_SIZE must be odd and the average window at most 2^(31 - HX711_SAMPLE_BITS)"
+#endif
+
+#if ((HX711_OUTLIER_WINDOW & 1U) == 0) || (HX711_OUTLIER_WINDOW < 3) || (HX711_OUTLIER_WINDOW > 15)
+#error "HX711_OUTLIER_WINDOW must be odd and between 3 and 15"
+#endif
+
+#if (HX711_DECIMATE_MAX_LOG2 > (31 - HX711_SAMPLE_BITS))
+#error "HX711_DECIMATE_MAX_LOG2 must not exceed 31 - HX711_SAMPLE_BITS (6 with auto-ranging: 25-bit samples in a 32-bit sum)"
+#endif
+
+#if (HX711_ADAPTIVE_MAX_SHIFT > (31 - HX711_SAMPLE_BITS)) || (HX711_FILTER_IIR_SHIFT > (31 - HX711_SAMPLE_BITS))
+#error "HX711_ADAPTIVE_MAX_SHIFT and HX711_FILTER_IIR_SHIFT must not exceed 31 - HX711_SAMPLE_BITS (scaled samples in 32-bit state)"
+#endif
+
+/* Largest count whose HX711_SAMPLE_BITS-wide samples fit a 32-bit sum */
+#define HX711_AVERAGE_MAX_SAMPLES       ((uint8)((1U << (32 - HX711_SAMPLE_BITS)) - 1U))
+
+#if HX711_MULTI_CELL_ENABLED
+#if (HX711_TRANSPORT != HX711_TRANSPORT_BITBANG)
+#error "HX711_MULTI_CELL_ENABLED requires the bit-banged transport"
+#endif
+#if (HX711_MULTI_CELL_COUNT < 1) || (HX711_MULTI_CELL_COUNT > 8)
+#error "HX711_MULTI_CELL_COUNT must be between 1 and 8 (one DOUT port)"
+#endif
+#endif
+
+#if HX711_INTERLEAVE_ENABLED
+#define HX711_CHANNEL_B_BUFFER_MASK  (HX711_CHANNEL_B_BUFFER_SIZE - 1U)
+#define HX711_CHANNEL_B_PULSES       2U   /* channel B, gain 32 */
+#define HX711_SAMPLE_SETTLING        0xFFU
 
+#if ((HX711_CHANNEL_B_BUFFER_SIZE & HX711_CHANNEL_B_BUFFER_MASK) != 0) || (HX711_CHANNEL_B_BUFFER_SIZE > 128)
+#error "HX711_CHANNEL_B_BUFFER_SIZE must be a power of two not larger than 128"
+#endif
+
+#if (HX711_INTERLEAVE_RUN_A < 2) || (HX711_INTERLEAVE_RUN_B < 2)
+#error "Interleave runs need at least 2 conversions (the first one is dropped)"
+#endif
+#endif
+
+#if HX711_ISR_ACQUISITION_ENABLED
+#define HX711_SAMPLE_BUFFER_MASK  (HX711_SAMPLE_BUFFER_SIZE - 1U)
+
+#if ((HX711_SAMPLE_BUFFER_SIZE & HX711_SAMPLE_BUFFER_MASK) != 0) || (HX711_SAMPLE_BUFFER_SIZE > 128)
+#error "HX711_SAMPLE_BUFFER_SIZE must be a power of two not larger than 128"
+#endif
+#endif
+
+#if HX711_RECORDER_ENABLED
+#if ((HX711_RECORDER_BYTES & (HX711_RECORDER_BYTES - 1)) != 0) || (HX711_RECORDER_BYTES < 8) || (HX711_RECORDER_BYTES > 256)
+#error "HX711_RECORDER_BYTES must be a power of two between 8 and 256"
+#endif
+#endif
 
 /*---------------------------------------------------------------------------------
- * PRIVATE FUNCTIONS (for real hardware)
- *---------------------------------------------------------------------------------*/
+ * PRIVATE FUNCTION PROTOTYPES
+ *--------------------------------------------------------------------------------*/
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+static uint8  spi_transferByte(void);
+#elif HX711_BENCHMARK_ENABLED
+static uint8  shiftIn_MSB(void);
+#endif
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI) || HX711_BENCHMARK_ENABLED || HX711_MULTI_CELL_ENABLED
+static void   hx711_gainPulses(uint8 pulses);
+#endif
+static void   hx711_updateScaleDerived(void);
+static void   hx711_releaseSck(void);
+static void   stability_update(sint32 raw);
+static void   zeroTrack_update(void);
+static void   predict_restart(void);
+static void   predict_update(sint32 raw, uint8 wasStable);
+static sint32 hx711_gramsToCounts(sint32 grams);
+static sint32 hx711_scaleToRecip(double scale);
+static sint32 hx711_countsToGrams(sint32 counts, sint32 scaleRecip);
+static uint16 hx711_isqrt(uint32 value);
+static sint32 hx711_averageSum(sint32 sum, uint8 count);
+static uint8  hx711_readBounded(sint32 *value);
+static uint8  hx711_calibrationAverage(sint32 *mean);
+static uint8  calibration_insert(sint32 counts, sint32 grams);
+static uint8  calibration_rebuild(void);
+static sint32 calibration_lookup(sint32 counts);
+static uint8  calibration_segment(sint32 counts);
+#if HX711_MULTI_CELL_ENABLED
+static void   multi_shiftInAll(sint32 *raw);
+#endif
+static uint8  hx711_nextGainPulses(void);
+static sint32 hx711_shiftInSample(void);
+#if HX711_BENCHMARK_ENABLED
+static sint32 hx711_shiftInBytes(void);
+#endif
+static uint8  hx711_deliverChannelA(sint32 *raw);
+static uint8  hx711_routeSample(sint32 *raw);
+#if HX711_TIMING_ENABLED
+static void   timing_update(void);
+#endif
+#if HX711_AUTORANGE_ENABLED
+static void   autorange_schedule(uint8 pulses);
+static uint8  autorange_apply(sint32 *raw);
+static void   autorange_updateMapping(void);
+static uint8  autorange_captureLowGain(sint32 *average);
+#endif
+#if HX711_RECORDER_ENABLED
+static void   recorder_put(uint8 value);
+static void   recorder_dropOldest(void);
+static void   recorder_append(sint32 raw);
+#endif
+#if HX711_INTERLEAVE_ENABLED
+static uint8  interleave_schedule(void);
+#endif
+static sint32 hx711_read_simulated(void);
+static sint32 sim_weight_to_raw(double kg);
+static sint32 sim_traceNext(void);
+static sint32 sim_scenarioNext(void);
+static sint32 sim_noiseMg(uint16 peakMg);
+static uint8  sim_encodeSample(sint32 sample, sint32 previous, uint8 first, uint8 *out, uint16 room);
+static void   filter_prime(sint32 raw);
+static sint32 filter_movingAverage(sint32 raw);
+static sint32 filter_median(sint32 raw);
+static sint32 filter_iir(sint32 raw);
+static sint32 filter_adaptive(sint32 raw);
+static void   kalman_restart(sint32 raw);
+static sint32 filter_kalman(sint32 raw);
+static sint32 hx711_countsQToMilligrams(sint32 countsQ, sint32 scaleRecip, uint8 frac);
+static HX711_Status_t fault_noData(uint16 waitedMs);
+static void   decimate_update(sint32 raw);
+static sint32 outlier_reject(sint32 raw);
+static sint32 notch_apply(HX711_Notch_t *notch, sint32 raw);
+static void   outlier_sortWindow(sint32 *values);
+
+/*---------------------------------------------------------------------------------
+ * PRIVATE FUNCTIONS
+ *--------------------------------------------------------------------------------*/
+
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+/*
+ * Clock 8 bits MSB-first from HX711 DOUT (MISO) with the SPI block.
+ */
+static uint8 spi_transferByte(void)
+{
+    SPDR = 0x00;
+
+    while(BIT_IS_CLEAR(SPSR, SPIF))
+    {
+    }
+
+    return SPDR;
+}
+#elif HX711_BENCHMARK_ENABLED
+/*
+ * Shift in 8 bits MSB-first from HX711 DOUT, clocked by SCK. Only the
+ * byte-wise reference readout in hx711_benchmarkShiftIn() still uses it.
+ */
 static uint8 shiftIn_MSB(void)
 {
     uint8 value = 0;
@@ -39,693 +479,4410 @@ static uint8 shiftIn_MSB(void)
     {
         HX711_SCK_HIGH();
         _delay_us(HX711_PULSE_DELAY_US);
+
         value |= (HX711_DOUT_READ() << (7 - i));
+
         HX711_SCK_LOW();
         _delay_us(HX711_PULSE_DELAY_US);
     }
 
     return value;
 }
+#endif
 
-/*---------------------------------------------------------------------------------
- * PUBLIC FUNCTION IMPLEMENTATIONS
- *---------------------------------------------------------------------------------*/
-
-/*---------------------------------------------------------------------------------*/
-void hx711_init(uint8 gain, double scale, sint32 offset)
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI) || HX711_BENCHMARK_ENABLED || HX711_MULTI_CELL_ENABLED
+/*
+ * Emit the 1-3 trailing SCK pulses that select gain/channel for the next
+ * conversion. The bit-banged read clocks them in its own loop.
+ */
+static void hx711_gainPulses(uint8 pulses)
 {
-    /* Store scale and offset */
-    g_scale = scale;
-    g_offset = offset;
+    uint8 i;
 
-    /* Set gain */
-    switch(gain)
+    for(i = 0; i < pulses; i++)
     {
-        case HX711_GAINCHANNELA128:
-            g_gain = 1;
-            g_gainValue = 128;
-            break;
-        case HX711_GAINCHANNELA64:
-            g_gain = 3;
-            g_gainValue = 64;
-            break;
-        case HX711_GAINCHANNELB32:
-            g_gain = 2;
-            g_gainValue = 32;
-            break;
-        default:
-            g_gain = 1;
-            g_gainValue = 128;
-            break;
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+        /* Only the SCK-high phase has to be protected */
+        uint8 sreg = SREG;
+        cli();
+        HX711_BENCH_IRQOFF_BEGIN();
+#endif
+        HX711_SCK_HIGH();
+        _delay_us(HX711_PULSE_DELAY_US);
+        HX711_SCK_LOW();
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+        HX711_BENCH_IRQOFF_END();
+        SREG = sreg;
+#endif
+        _delay_us(HX711_PULSE_DELAY_US);
     }
+}
+#endif
 
-    /* Configure hardware pins */
-    SET_BIT(HX711_SCK_DDR, HX711_SCK_PINNUM);
-    HX711_SCK_LOW();
+/*
+ * Gain pulses that end this read: the interleave schedule or the channel A
+ * gain, noted for auto-ranging. Called exactly once per readout, inside
+ * its critical section. Benchmark reads repeat the gain of the conversion
+ * in progress and leave the interleave and auto-range state untouched.
+ */
+static uint8 hx711_nextGainPulses(void)
+{
+    uint8 pulses;
 
-    CLEAR_BIT(HX711_DOUT_DDR, HX711_DOUT_PINNUM);
-    SET_BIT(HX711_DOUT_PORT, HX711_DOUT_PINNUM);
+#if HX711_BENCHMARK_ENABLED
+    if(g_benchHold)
+    {
+#if HX711_AUTORANGE_ENABLED
+        return g_convPulses;
+#elif HX711_INTERLEAVE_ENABLED
+        return (g_convChannel == HX711_CHANNEL_A) ? g_gain : HX711_CHANNEL_B_PULSES;
+#else
+        return g_gain;
+#endif
+    }
+#endif
 
-    _delay_ms(200);
+#if HX711_INTERLEAVE_ENABLED
+    pulses = interleave_schedule();
+#else
+    pulses = g_gain;
+#endif
+#if HX711_AUTORANGE_ENABLED
+    autorange_schedule(pulses);
+#endif
 
+    return pulses;
 }
 
-/*---------------------------------------------------------------------------------*/
-uint8 hx711_isready(void)
+/*
+ * Clock one conversion out of the HX711 (24 data bits + gain pulses) and
+ * return it sign-extended. DOUT must already be low; the caller wraps the
+ * call in HX711_READ_CRITICAL_BEGIN()/END().
+ *
+ * Bit-banged, one loop of 24 + pulses SCK periods shifts DOUT straight
+ * into a 32-bit register (no byte buffer, no per-bit variable shift) and
+ * skips the sample on the trailing gain pulses. The 24-bit two's
+ * complement value is then sign-extended in place with one xor / subtract.
+ */
+static sint32 hx711_shiftInSample(void)
 {
-    return (HX711_DOUT_READ() == 0) ? 1 : 0;
+    uint8  pulses = hx711_nextGainPulses();
+    uint32 value  = 0;
 
-}
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+    SPCR = HX711_SPI_SPCR;
+    SPSR = HX711_SPI_SPSR;
 
-/*---------------------------------------------------------------------------------*/
-sint32 hx711_read(void)
-{
-    uint8 data[3] = {0, 0, 0};
-    uint8 filler = 0x00;
-    uint32 value = 0;
-    uint8 i;
+    /* The sign travels with the first byte */
+    value = (uint32)(sint32)(sint8)spi_transferByte();
+    value = (value << 8) | spi_transferByte();
+    value = (value << 8) | spi_transferByte();
 
-    /* Wait for ready */
-    while(!hx711_isready())
-    {
-        _delay_us(10);
-    }
+    /* Hand SCK back to PORTB for the gain pulses */
+    SPCR = 0;
 
-    /* Disable interrupts */
-    cli();
+    hx711_gainPulses(pulses);
 
-    /* Read 24 bits */
-    data[2] = shiftIn_MSB();
-    data[1] = shiftIn_MSB();
-    data[0] = shiftIn_MSB();
+    return (sint32)value;
+#else
+    uint8 clocks = (uint8)(HX711_DATA_BITS + pulses);
 
-    /* Set gain for next reading */
-    for(i = 0; i < g_gain; i++)
+    do
     {
         HX711_SCK_HIGH();
         _delay_us(HX711_PULSE_DELAY_US);
+
+        if(clocks > pulses)
+        {
+            value <<= 1;
+            if(HX711_DOUT_PIN & (1U << HX711_DOUT_PINNUM))
+            {
+                value |= 1UL;
+            }
+        }
+
         HX711_SCK_LOW();
         _delay_us(HX711_PULSE_DELAY_US);
     }
+    while(--clocks != 0U);
+
+    return (sint32)((value ^ 0x00800000UL) - 0x00800000UL);
+#endif
+}
+
+#if HX711_BENCHMARK_ENABLED
+/*
+ * Byte-wise readout the driver used before hx711_shiftInSample() was
+ * folded into one loop: three 8-bit transfers into a buffer, separate gain
+ * pulses, filler byte and reassembly. Kept as the reference for
+ * hx711_benchmarkShiftIn().
+ */
+static sint32 hx711_shiftInBytes(void)
+{
+    uint8  data[3] = {0, 0, 0};
+    uint8  filler  = 0x00;
+    uint32 value   = 0;
+
+    /* Read 24 bits MSB-first */
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+    SPCR = HX711_SPI_SPCR;
+    SPSR = HX711_SPI_SPSR;
+
+    data[2] = spi_transferByte();
+    data[1] = spi_transferByte();
+    data[0] = spi_transferByte();
+
+    /* Hand SCK back to PORTB for the gain pulses */
+    SPCR = 0;
+#else
+    data[2] = shiftIn_MSB();
+    data[1] = shiftIn_MSB();
+    data[0] = shiftIn_MSB();
+#endif
 
-    /* Re-enable interrupts */
-    sei();
+    /* Set gain for next reading */
+    hx711_gainPulses(hx711_nextGainPulses());
 
     /* Sign extension */
-    if(data[2] & 0x80) {
+    if(data[2] & 0x80)
+    {
         filler = 0xFF;
     }
 
-    /* Construct 32-bit value */
+    /* Build 32-bit signed value */
     value = ((uint32)filler << 24) |
             ((uint32)data[2] << 16) |
-            ((uint32)data[1] << 8) |
+            ((uint32)data[1] << 8)  |
             ((uint32)data[0]);
 
     return (sint32)value;
+}
+#endif
+
+#if HX711_INTERLEAVE_ENABLED
+/*
+ * Called once per read, before its gain pulses are sent. Tags the
+ * sample just shifted in with the channel it was converted on (or as a
+ * settling sample), picks the channel of the conversion after next and
+ * returns the pulse count that selects it.
+ */
+static uint8 interleave_schedule(void)
+{
+    uint8 channel = g_convChannel;
+    uint8 next    = HX711_CHANNEL_A;
+
+    g_interleaveRun++;
+
+    if(g_interleaveActive)
+    {
+        uint8 runLength = (channel == HX711_CHANNEL_A) ? HX711_INTERLEAVE_RUN_A
+                                                       : HX711_INTERLEAVE_RUN_B;
+
+        next = channel;
+        if(g_interleaveRun >= runLength)
+        {
+            next = (channel == HX711_CHANNEL_A) ? HX711_CHANNEL_B : HX711_CHANNEL_A;
+        }
+    }
+
+    g_sampleTag = g_interleaveSettling ? HX711_SAMPLE_SETTLING : channel;
 
+    g_interleaveSettling = (next != channel) ? 1U : 0U;
+    if(g_interleaveSettling)
+    {
+        g_interleaveRun = 0;
+    }
+    g_convChannel = next;
+
+    return (next == HX711_CHANNEL_A) ? g_gain : HX711_CHANNEL_B_PULSES;
 }
+#endif
 
-/*---------------------------------------------------------------------------------*/
-sint32 hx711_readaverage(uint8 times)
+/*
+ * Channel A sample about to be delivered: auto-ranging drops or maps it,
+ * and only what is delivered is recorded, in the counts the filters see.
+ */
+static uint8 hx711_deliverChannelA(sint32 *raw)
 {
-    sint64 sum = 0;
-    uint8 i;
+#if HX711_AUTORANGE_ENABLED
+    if(!autorange_apply(raw))
+    {
+        return 0U;
+    }
+#endif
 
-    for(i = 0; i < times; i++)
+#if HX711_RECORDER_ENABLED
+    recorder_append(*raw);
+#endif
+
+    return 1U;
+}
+
+/*
+ * Sort the sample just shifted in. Returns 1 for a channel A sample the
+ * caller should deliver; channel B samples are queued on their own stream
+ * and settling samples dropped. Warm-up samples are dropped here too, and
+ * the sample that completes the idle timeout powers the chip down. With
+ * auto-ranging a delivered gain 64 sample is rewritten in gain 128 counts.
+ */
+static uint8 hx711_routeSample(sint32 *raw)
+{
+#if HX711_INTERLEAVE_ENABLED
+    uint8 head;
+    uint8 next;
+#endif
+
+#if HX711_RECORDER_ENABLED
+    g_recTick++;
+#endif
+
+#if HX711_TIMING_ENABLED
+    timing_update();
+#endif
+
+    if((*raw == HX711_RAW_MAX) || (*raw == HX711_RAW_MIN))
     {
-        sum += (sint64)hx711_read();
-        _delay_ms(5);
+        if(g_railCount < 0xFFU)
+        {
+            g_railCount++;
+        }
+    }
+    else
+    {
+        g_railCount = 0;
+    }
+
+#if HX711_AUTO_POWERDOWN_ENABLED
+    if(g_warmupDiscard > 0U)
+    {
+        g_warmupDiscard--;
+        return 0U;
+    }
+
+    if((g_idleLimit > 0U) && (++g_idleSamples >= g_idleLimit))
+    {
+        /* SCK held high > 60 us: the chip stops after this conversion */
+        HX711_SCK_HIGH();
+        g_poweredDown = 1;
+        return 0U;
+    }
+#endif
+
+#if HX711_INTERLEAVE_ENABLED
+
+    if(g_sampleTag == HX711_CHANNEL_A)
+    {
+        return hx711_deliverChannelA(raw);
+    }
+
+    if(g_sampleTag == HX711_CHANNEL_B)
+    {
+        head = g_channelBHead;
+        next = (uint8)((head + 1U) & HX711_CHANNEL_B_BUFFER_MASK);
+
+        if(next != g_channelBTail)
+        {
+            g_channelBBuffer[head] = *raw;
+            g_channelBHead         = next;
+        }
+#if HX711_ISR_ACQUISITION_ENABLED
+        else if(g_sampleOverruns < 0xFFU)
+        {
+            g_sampleOverruns++;
+        }
+#endif
     }
 
-    return (sint32)(sum / times);
+    return 0U;
+#else
+    return hx711_deliverChannelA(raw);
+#endif
 }
 
-/*---------------------------------------------------------------------------------*/
-double hx711_getweight(void)
+/*
+ * Recompute everything derived from g_scale (fixed-point reciprocal,
+ * thresholds in counts). This is the only place the weight path still
+ * divides in floating point.
+ */
+static void hx711_updateScaleDerived(void)
 {
-    sint32 raw = hx711_readaverage(1);
-    double weight = (double)(raw - g_offset) / g_scale;
+    g_scaleRecip = hx711_scaleToRecip(g_scale);
+
+    /* Bands configured in grams follow the calibration */
+    g_stableThreshold = hx711_gramsToCounts(HX711_STABLE_BAND_GRAMS);
+    g_faultNoiseBand  = hx711_gramsToCounts(HX711_FAULT_NOISE_GRAMS);
+    g_adaptStep       = hx711_gramsToCounts(HX711_ADAPTIVE_STEP_GRAMS);
+    g_predAgree       = hx711_gramsToCounts(HX711_PREDICT_AGREE_GRAMS);
+    g_zeroTrackWindow = hx711_gramsToCounts(HX711_ZERO_TRACK_WINDOW_GRAMS);
+    g_zeroTrackLimit  = hx711_gramsToCounts(HX711_ZERO_TRACK_LIMIT_GRAMS);
+    g_outlierFloor    = hx711_gramsToCounts(HX711_OUTLIER_MIN_GRAMS);
+
+    /* Kalman gate in counts^2: (gate * sigma_meas)^2 */
+    {
+        double gate = (double)HX711_KALMAN_GATE_SIGMA * (double)g_kalMeasMg * g_scale / 1000000.0;
 
-    /* Ensure non-negative */
-    if(weight < 0.0) {
-        weight = 0.0;
+        g_kalGateSq = (sint64)(gate * gate);
     }
 
-    return weight;
+#if HX711_AUTORANGE_ENABLED
+    autorange_updateMapping();
+#endif
 }
 
-/*---------------------------------------------------------------------------------*/
-void hx711_calibrate1setoffset(void)
+/*
+ * Q32 grams-per-count reciprocal of a counts-per-kg scale, saturated and
+ * rounded to nearest.
+ */
+static sint32 hx711_scaleToRecip(double scale)
 {
-    /* Tare - set offset to current average reading */
-    g_offset = hx711_readaverage(10);
+    double recip = ((double)HX711_GRAMS_PER_KG * 4294967296.0) / scale;
 
+    if(recip > 2147483647.0)
+        recip = 2147483647.0;
+    else if(recip < -2147483647.0)
+        recip = -2147483647.0;
+
+    return (sint32)((recip < 0.0) ? (recip - 0.5) : (recip + 0.5));
 }
 
-/*---------------------------------------------------------------------------------*/
-void hx711_calibrate2setscale(double knownWeight)
+/*
+ * Tared counts times a Q32 reciprocal, rounded to nearest gram.
+ */
+static sint32 hx711_countsToGrams(sint32 counts, sint32 scaleRecip)
 {
-    /* Calculate scale factor based on known weight */
-    sint32 rawValue = hx711_readaverage(10);
-    g_scale = (double)(rawValue - g_offset) / knownWeight;
+    sint64 product = (sint64)counts * scaleRecip;
+
+    return (sint32)((product + (1LL << (HX711_SCALE_RECIP_FRAC_BITS - 1)))
+                    >> HX711_SCALE_RECIP_FRAC_BITS);
+}
+
+/*
+ * Integer square root (floor), bit by bit.
+ */
+static uint16 hx711_isqrt(uint32 value)
+{
+    uint32 root = 0;
+    uint32 bit  = 1UL << 30;
+
+    while(bit > value)
+    {
+        bit >>= 2;
+    }
 
+    while(bit != 0UL)
+    {
+        if(value >= root + bit)
+        {
+            value -= root + bit;
+            root   = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
 
+    return (uint16)root;
 }
 
-/*---------------------------------------------------------------------------------*/
-void hx711_taretozero(void)
+/*
+ * Averaged reading used by tare and calibration: stops at the default
+ * precision target and keeps the outcome for hx711_getLastAverageResult().
+ */
+static uint8 hx711_calibrationAverage(sint32 *mean)
 {
-    /* Same as calibrate1setoffset */
-    hx711_calibrate1setoffset();
+    (void)hx711_readPreciseAverage(HX711_PRECISE_TARGET_SEM_MG, HX711_PRECISE_MAX_SAMPLES,
+                                   &g_lastAverage);
+
+    *mean = g_lastAverage.mean;
+
+    /* A read that timed out leaves HX711_FAULT_NO_DATA raised */
+    return (g_noDataMs < HX711_NO_DATA_TIMEOUT_MS) ? 1U : 0U;
 }
 
-/*---------------------------------------------------------------------------------*/
-void hx711_setscale(double scale)
+/*
+ * Insert one (counts, grams) point in counts order, seeding the table with
+ * the tare point first. Rejected (table unchanged) when full, when the
+ * counts duplicate an existing point or when the curve would stop being
+ * monotonic.
+ */
+static uint8 calibration_insert(sint32 counts, sint32 grams)
+{
+    uint8 pos;
+    uint8 i;
+
+    if((counts == 0) || (grams == 0))
+    {
+        return 0U;
+    }
+
+    if(g_calCount == 0U)
+    {
+        g_calCounts[0] = 0;
+        g_calGrams[0]  = 0;
+        g_calCount     = 1;
+    }
+
+    if(g_calCount > HX711_CAL_MAX_POINTS)
+    {
+        return 0U;
+    }
+
+    pos = 0;
+    while((pos < g_calCount) && (g_calCounts[pos] < counts))
+    {
+        pos++;
+    }
+
+    if((pos < g_calCount) && (g_calCounts[pos] == counts))
+    {
+        return 0U;
+    }
+
+    for(i = g_calCount; i > pos; i--)
+    {
+        g_calCounts[i] = g_calCounts[i - 1U];
+        g_calGrams[i]  = g_calGrams[i - 1U];
+    }
+    g_calCounts[pos] = counts;
+    g_calGrams[pos]  = grams;
+    g_calCount++;
+
+    if(!calibration_rebuild())
+    {
+        for(i = pos; i < (uint8)(g_calCount - 1U); i++)
+        {
+            g_calCounts[i] = g_calCounts[i + 1U];
+            g_calGrams[i]  = g_calGrams[i + 1U];
+        }
+        g_calCount--;
+        (void)calibration_rebuild();
+
+        return 0U;
+    }
+
+    return 1U;
+}
+
+/*
+ * Check the table is strictly monotonic and precompute the per-segment
+ * Q32 slopes so the lookup never divides.
+ */
+static uint8 calibration_rebuild(void)
 {
-    g_scale = scale;
+    sint8 direction = 0;
+    uint8 i;
+
+    for(i = 0; (uint8)(i + 1U) < g_calCount; i++)
+    {
+        sint32 dGrams  = g_calGrams[i + 1U] - g_calGrams[i];
+        sint32 dCounts = g_calCounts[i + 1U] - g_calCounts[i];
+        sint64 slope;
+
+        if(direction == 0)
+        {
+            direction = (dGrams > 0) ? 1 : -1;
+        }
+
+        if((dGrams == 0) || ((dGrams > 0) != (direction > 0)))
+        {
+            return 0U;
+        }
+
+        slope = ((sint64)dGrams << HX711_SCALE_RECIP_FRAC_BITS) / dCounts;
+        if(slope > 2147483647LL)
+            slope = 2147483647LL;
+        else if(slope < -2147483647LL)
+            slope = -2147483647LL;
+
+        g_calSlope[i] = (sint32)slope;
+    }
+
+    return 1U;
 }
 
-/*---------------------------------------------------------------------------------*/
-double hx711_getscale(void)
+/*
+ * Binary search for the segment holding the tared counts; the outer
+ * segments extend past the ends. Returns the index of its lower point.
+ */
+static uint8 calibration_segment(sint32 counts)
 {
-    return g_scale;
+    uint8 lo = 0;
+    uint8 hi = (uint8)(g_calCount - 1U);
+
+    while((uint8)(hi - lo) > 1U)
+    {
+        uint8 mid = (uint8)((lo + hi) >> 1);
+
+        if(counts < g_calCounts[mid])
+            hi = mid;
+        else
+            lo = mid;
+    }
+
+    return lo;
 }
 
-/*---------------------------------------------------------------------------------*/
-void hx711_setoffset(sint32 offset)
+/*
+ * Table lookup: one multiply/shift from the lower point of the segment.
+ */
+static sint32 calibration_lookup(sint32 counts)
 {
-    g_offset = offset;
+    uint8 lo = calibration_segment(counts);
+
+    return g_calGrams[lo] + hx711_countsToGrams(counts - g_calCounts[lo], g_calSlope[lo]);
+}
 
+/*
+ * Counts with frac fractional bits times a Q32 reciprocal, in mg:
+ * countsQ * recip / 2^(32 + frac) g, split so the 1000x does not overflow.
+ */
+static sint32 hx711_countsQToMilligrams(sint32 countsQ, sint32 scaleRecip, uint8 frac)
+{
+    sint64 product = ((sint64)countsQ * scaleRecip) >> 16;
 
+    return (sint32)((product * HX711_GRAMS_PER_KG) >> (16 + frac));
 }
 
-/*---------------------------------------------------------------------------------*/
-sint32 hx711_getoffset(void)
+/*
+ * Rounded mean of count samples summed in 32 bits. Callers keep count at
+ * or below HX711_AVERAGE_MAX_SAMPLES for HX711_SAMPLE_BITS-wide samples
+ * (127 mapped 25-bit ones, 255 raw 24-bit multi-cell ones). Power-of-two
+ * counts take an arithmetic shift; any other count one 32-bit division,
+ * so libgcc's 64-bit divide is not needed.
+ */
+static sint32 hx711_averageSum(sint32 sum, uint8 count)
 {
-    return g_offset;
+    uint8 log2 = 0;
+
+    if((count & (uint8)(count - 1U)) == 0U)
+    {
+        while((uint8)(1U << log2) < count)
+        {
+            log2++;
+        }
+
+        return (sum + ((1L << log2) >> 1)) >> log2;
+    }
+
+    return (sum + ((sum < 0) ? -(sint32)(count >> 1) : (sint32)(count >> 1))) / (sint32)count;
 }
 
-/*---------------------------------------------------------------------------------*/
-uint8 hx711_getgain(void)
+/*
+ * Convert a configured band in grams to an absolute count span using the
+ * current scale. Only called when the scale changes.
+ */
+static sint32 hx711_gramsToCounts(sint32 grams)
 {
-    return g_gainValue;
+    sint32 counts = (sint32)((double)grams * g_scale / (double)HX711_GRAMS_PER_KG);
+
+    return (counts < 0) ? -counts : counts;
 }
 
-/*---------------------------------------------------------------------------------*/
-void hx711_powerdown(void)
+/*
+ * Convert desired weight in kg to a synthetic raw reading, using
+ * current scale and offset so that hx711_getweight() returns ~kg.
+ */
+static sint32 sim_weight_to_raw(double kg)
 {
-    HX711_SCK_LOW();
-    _delay_us(2);
-    HX711_SCK_HIGH();
-    _delay_us(70);
+    /* raw = offset + scale * kg */
+    double raw = (double)g_offset + (g_scale * kg);
+    if(raw > 2147483647.0)
+        raw = 2147483647.0;
+    else if(raw < -2147483648.0)
+        raw = -2147483648.0;
+
+    return (sint32)raw;
 }
 
-/*---------------------------------------------------------------------------------*/
-void hx711_powerup(void)
+/*
+ * Next sample of the loaded trace. A non-looping trace holds its last
+ * sample once it runs out and flags the end for hx711_simIsFinished().
+ */
+static sint32 sim_traceNext(void)
 {
-    HX711_SCK_LOW();
-    _delay_us(2);
+    uint8 code;
+
+    if((g_simTracePos >= g_simTraceLength) && g_simTraceLoop)
+    {
+        g_simTracePos = 0;
+    }
 
+    if(g_simTracePos >= g_simTraceLength)
+    {
+        g_simFinished = 1;
+        return g_simTraceRaw;
+    }
+
+    code = g_simTrace[g_simTracePos++];
+
+    /* Conversions the recorder did not keep: let simulated time pass */
+    while((code == HX711_SIM_TRACE_GAP) && ((uint16)(g_simTracePos + 1U) < g_simTraceLength))
+    {
+        uint32 gap = g_simTrace[g_simTracePos++];
+
+        if(gap == 0UL)
+        {
+            /* Long gap: 32-bit count follows */
+            if((uint16)(g_simTracePos + 4U) >= g_simTraceLength)
+            {
+                break;
+            }
+            gap = ((uint32)g_simTrace[g_simTracePos]     << 24) |
+                  ((uint32)g_simTrace[g_simTracePos + 1] << 16) |
+                  ((uint32)g_simTrace[g_simTracePos + 2] << 8)  |
+                  ((uint32)g_simTrace[g_simTracePos + 3]);
+            g_simTracePos += 4U;
+        }
+        g_simTicksMs += gap * HX711_SIM_TICK_MS;
+        code = g_simTrace[g_simTracePos++];
+    }
+
+    if(code == HX711_SIM_TRACE_GAP)
+    {
+        g_simTracePos = g_simTraceLength;
+        g_simFinished = 1;
+        return g_simTraceRaw;
+    }
+
+    if(code == HX711_SIM_TRACE_ESCAPE)
+    {
+        if((uint16)(g_simTracePos + 4U) > g_simTraceLength)
+        {
+            g_simTracePos = g_simTraceLength;
+            g_simFinished = 1;
+            return g_simTraceRaw;
+        }
+
+        /* Sign from the top byte, so host builds with a wider long agree */
+        g_simTraceRaw = (sint32)(sint8)g_simTrace[g_simTracePos] * 0x1000000L +
+                        (sint32)(((uint32)g_simTrace[g_simTracePos + 1] << 16) |
+                                 ((uint32)g_simTrace[g_simTracePos + 2] << 8)  |
+                                 ((uint32)g_simTrace[g_simTracePos + 3]));
+        g_simTracePos += 4U;
+    }
+    else
+    {
+        g_simTraceRaw += (sint8)code;
+    }
+
+    g_simTicksMs += HX711_SIM_TICK_MS;
+
+    return g_simTraceRaw;
+}
+
+/*
+ * Append one sample to a trace: a delta byte when it is within -126..127 of
+ * the previous sample, otherwise an escaped absolute value. Samples keep
+ * their full width (auto-ranged ones exceed 24 bits). Returns the bytes
+ * written, 0 if they do not fit in room.
+ */
+static uint8 sim_encodeSample(sint32 sample, sint32 previous, uint8 first, uint8 *out, uint16 room)
+{
+    sint32 delta = sample - previous;
+
+    if(!first && (delta >= -126) && (delta <= 127))
+    {
+        if(room < 1U)
+        {
+            return 0U;
+        }
+        out[0] = (uint8)(sint8)delta;
+        return 1U;
+    }
+
+    if(room < 5U)
+    {
+        return 0U;
+    }
+
+    out[0] = HX711_SIM_TRACE_ESCAPE;
+    out[1] = (uint8)((uint32)sample >> 24);
+    out[2] = (uint8)((uint32)sample >> 16);
+    out[3] = (uint8)((uint32)sample >> 8);
+    out[4] = (uint8)sample;
+
+    return 5U;
+}
+
+/*
+ * Deterministic noise: triangular in [-peakMg, peakMg] from two xorshift32
+ * draws, so every run of a scenario sees the same sequence.
+ */
+static sint32 sim_noiseMg(uint16 peakMg)
+{
+    sint32 sum = 0;
+    uint8  i;
+
+    if(peakMg == 0U)
+    {
+        return 0;
+    }
+
+    for(i = 0; i < 2U; i++)
+    {
+        g_simRng ^= g_simRng << 13;
+        g_simRng ^= g_simRng >> 17;
+        g_simRng ^= g_simRng << 5;
+        sum += (sint32)(g_simRng % (2UL * peakMg + 1UL)) - (sint32)peakMg;
+    }
+
+    return sum / 2;
+}
+
+/*
+ * Next sample of the running scenario, see SIMULATION CONFIGURATION.
+ */
+static sint32 sim_scenarioNext(void)
+{
+    const HX711_Scenario_t *sc = &g_simScenario;
+    uint32 t     = g_simTicksMs;
+    double grams = (double)sc->baseGrams;
+    double dt;
+    double settled;
+
+    if(t >= sc->startMs)
+    {
+        dt      = (double)(t - sc->startMs);
+        settled = (sc->tauMs > 0U) ? (1.0 - exp(-dt / (double)sc->tauMs)) : 1.0;
+
+        switch(sc->type)
+        {
+            case HX711_SCENARIO_DRIFT:
+                grams += (double)sc->driftMgPerS * dt / 1000000.0;
+                break;
+
+            case HX711_SCENARIO_CREEP:
+                grams += (double)sc->stepGrams + (double)sc->amplitudeGrams * settled;
+                break;
+
+            case HX711_SCENARIO_STEP:
+            case HX711_SCENARIO_VIBRATION:
+            default:
+                grams += (double)sc->stepGrams * settled;
+                break;
+        }
+    }
+
+    if((sc->type == HX711_SCENARIO_VIBRATION) && (sc->periodMs > 0U))
+    {
+        grams += (double)sc->amplitudeGrams * sin(6.283185307 * (double)t / sc->periodMs);
+    }
+
+    grams += (double)sim_noiseMg(sc->noiseMg) / 1000.0;
+
+    g_simTicksMs += HX711_SIM_TICK_MS;
+
+    return sim_weight_to_raw(grams / 1000.0);
+}
+
+static sint32 hx711_read_simulated(void)
+{
+    double targetKg;
+    uint32 elapsed;
+
+    if(g_simSource == HX711_SIM_SOURCE_TRACE)
+    {
+        return sim_traceNext();
+    }
+
+    if(g_simSource == HX711_SIM_SOURCE_SCENARIO)
+    {
+        return sim_scenarioNext();
+    }
+
+    if(!g_simPatternActive)
+    {
+        g_simPatternActive = 1;
+        g_simTicksMs       = 0;
+    }
+
+    elapsed = g_simTicksMs;
+
+    if(elapsed < 2000U)
+    {
+        /* Phase 1: 1 kg with small noise ±0.005 kg */
+        double noise;
+        uint8 slot = (uint8)((elapsed / 100U) % 11U);  /* 0-10 pattern */
+
+        /* Create smooth noise pattern from -0.005 to +0.005 kg */
+        switch(slot)
+        {
+            case 0:  noise = -0.005; break;
+            case 1:  noise = -0.004; break;
+            case 2:  noise = -0.003; break;
+            case 3:  noise = -0.002; break;
+            case 4:  noise = -0.001; break;
+            case 5:  noise =  0.000; break;
+            case 6:  noise =  0.001; break;
+            case 7:  noise =  0.002; break;
+            case 8:  noise =  0.003; break;
+            case 9:  noise =  0.004; break;
+            case 10: noise =  0.005; break;
+            default: noise =  0.000; break;
+        }
+
+        targetKg = 1.0 + noise;
+    }
+    else if(elapsed < 5000U)
+    {
+    	/* Phase 1: 1 kg with small noise ±0.005 kg */
+    	        double noise;
+    	        uint8 slot = (uint8)((elapsed / 100U) % 11U);  /* 0-10 pattern */
+
+    	        /* Create smooth noise pattern from -0.005 to +0.005 kg */
+    	        switch(slot)
+    	        {
+    	            case 0:  noise = -0.005; break;
+    	            case 1:  noise = -0.004; break;
+    	            case 2:  noise = -0.003; break;
+    	            case 3:  noise = -0.002; break;
+    	            case 4:  noise = -0.001; break;
+    	            case 5:  noise =  0.000; break;
+    	            case 6:  noise =  0.001; break;
+    	            case 7:  noise =  0.002; break;
+    	            case 8:  noise =  0.003; break;
+    	            case 9:  noise =  0.004; break;
+    	            case 10: noise =  0.005; break;
+    	            default: noise =  0.000; break;
+    	        }
+
+        /* Phase 2: 2 kg */
+        targetKg = 2.0+noise;
+    }
+    else
+    {
+    	/* Phase 1: 1 kg with small noise ±0.005 kg */
+    	        double noise;
+    	        uint8 slot = (uint8)((elapsed / 100U) % 11U);  /* 0-10 pattern */
+
+    	        /* Create smooth noise pattern from -0.005 to +0.005 kg */
+    	        switch(slot)
+    	        {
+    	            case 0:  noise = -0.005; break;
+    	            case 1:  noise = -0.004; break;
+    	            case 2:  noise = -0.003; break;
+    	            case 3:  noise = -0.002; break;
+    	            case 4:  noise = -0.001; break;
+    	            case 5:  noise =  0.000; break;
+    	            case 6:  noise =  0.001; break;
+    	            case 7:  noise =  0.002; break;
+    	            case 8:  noise =  0.003; break;
+    	            case 9:  noise =  0.004; break;
+    	            case 10: noise =  0.005; break;
+    	            default: noise =  0.000; break;
+    	        }
+
+        /* Phase 3: back to stable 1 kg */
+        targetKg = 1.0+noise;
+    }
+
+    /* Advance simulation "time" by one sample period per read */
+    g_simTicksMs += HX711_SIM_TICK_MS;
+
+    return sim_weight_to_raw(targetKg);
+}
+
+/*
+ * Fill every filter's history with the first sample so the output is
+ * meaningful immediately instead of ramping up from zero.
+ */
+static void filter_prime(sint32 raw)
+{
+    uint8 i;
+
+    for(i = 0; i < HX711_FILTER_AVG_WINDOW; i++)
+    {
+        g_avgWindow[i] = raw;
+    }
+    g_avgSum   = raw * (sint32)HX711_FILTER_AVG_WINDOW;
+    g_avgIndex = 0;
+
+    for(i = 0; i < HX711_FILTER_MEDIAN_SIZE; i++)
+    {
+        g_medianWindow[i] = raw;
+        g_medianSorted[i] = raw;
+    }
+    g_medianIndex = 0;
+
+    g_iirAcc = raw * (1L << HX711_FILTER_IIR_SHIFT);
+
+    g_adaptAcc     = raw * (1L << HX711_ADAPTIVE_MAX_SHIFT);
+    g_adaptShift   = 0;
+    g_adaptSettled = 0;
+
+    kalman_restart(raw);
+
+    g_filterPrimed = 1;
+}
+
+/*
+ * Running-sum moving average: swap the oldest sample for the newest.
+ */
+static sint32 filter_movingAverage(sint32 raw)
+{
+    g_avgSum += raw - g_avgWindow[g_avgIndex];
+    g_avgWindow[g_avgIndex] = raw;
+    g_avgIndex = (uint8)((g_avgIndex + 1U) & (HX711_FILTER_AVG_WINDOW - 1U));
+
+    return g_avgSum >> HX711_FILTER_AVG_WINDOW_LOG2;
+}
+
+/*
+ * Sorted-window median: drop the oldest sample from the sorted copy and
+ * slide the newest into place (at most N-1 moves).
+ */
+static sint32 filter_median(sint32 raw)
+{
+    sint32 oldest = g_medianWindow[g_medianIndex];
+    uint8  pos    = 0;
+
+    g_medianWindow[g_medianIndex] = raw;
+    g_medianIndex++;
+    if(g_medianIndex >= HX711_FILTER_MEDIAN_SIZE)
+    {
+        g_medianIndex = 0;
+    }
+
+    while(g_medianSorted[pos] != oldest)
+    {
+        pos++;
+    }
+
+    if(raw > oldest)
+    {
+        while((pos < (HX711_FILTER_MEDIAN_SIZE - 1U)) && (g_medianSorted[pos + 1U] < raw))
+        {
+            g_medianSorted[pos] = g_medianSorted[pos + 1U];
+            pos++;
+        }
+    }
+    else
+    {
+        while((pos > 0U) && (g_medianSorted[pos - 1U] > raw))
+        {
+            g_medianSorted[pos] = g_medianSorted[pos - 1U];
+            pos--;
+        }
+    }
+    g_medianSorted[pos] = raw;
+
+    return g_medianSorted[HX711_FILTER_MEDIAN_SIZE / 2U];
+}
+
+/*
+ * First-order IIR with the state kept in extra fractional bits so small
+ * steps are not lost to truncation.
+ */
+static sint32 filter_iir(sint32 raw)
+{
+    g_iirAcc += raw - (g_iirAcc >> HX711_FILTER_IIR_SHIFT);
+
+    return g_iirAcc >> HX711_FILTER_IIR_SHIFT;
+}
+
+/*
+ * Adaptive IIR: jump to the new level on a step, then lengthen the
+ * effective window as the run of settled samples grows.
+ */
+static sint32 filter_adaptive(sint32 raw)
+{
+    sint32 diff = raw - (g_adaptAcc >> HX711_ADAPTIVE_MAX_SHIFT);
+
+    if((diff > g_adaptStep) || (diff < -g_adaptStep))
+    {
+        g_adaptAcc     = raw * (1L << HX711_ADAPTIVE_MAX_SHIFT);
+        g_adaptShift   = 0;
+        g_adaptSettled = 0;
+
+        return raw;
+    }
+
+    if(g_adaptSettled < 0xFFU)
+    {
+        g_adaptSettled++;
+    }
+
+    if((g_adaptShift < HX711_ADAPTIVE_MAX_SHIFT) &&
+       (g_adaptSettled >= (uint8)(2U << g_adaptShift)))
+    {
+        g_adaptShift++;
+    }
+
+    g_adaptAcc += diff * (1L << (HX711_ADAPTIVE_MAX_SHIFT - g_adaptShift));
+
+    return g_adaptAcc >> HX711_ADAPTIVE_MAX_SHIFT;
+}
+
+/*
+ * Ascending insertion sort of one outlier window's worth of values.
+ */
+static void outlier_sortWindow(sint32 *values)
+{
+    uint8 i;
+
+    for(i = 1; i < HX711_OUTLIER_WINDOW; i++)
+    {
+        sint32 value = values[i];
+        uint8  j     = i;
+
+        while((j > 0U) && (values[j - 1U] > value))
+        {
+            values[j] = values[j - 1U];
+            j--;
+        }
+        values[j] = value;
+    }
+}
+
+/*
+ * Hampel test of the newest sample against its window. The window keeps
+ * the original samples so a real step takes over once it is the majority.
+ */
+static sint32 outlier_reject(sint32 raw)
+{
+    sint32 sorted[HX711_OUTLIER_WINDOW];
+    sint32 median;
+    sint32 threshold;
+    sint32 diff;
+    uint8  i;
+
+    g_outlierWindow[g_outlierIndex] = raw;
+    g_outlierIndex++;
+    if(g_outlierIndex >= HX711_OUTLIER_WINDOW)
+    {
+        g_outlierIndex = 0;
+    }
+
+    if(g_outlierCount < HX711_OUTLIER_WINDOW)
+    {
+        g_outlierCount++;
+        return raw;
+    }
+
+    for(i = 0; i < HX711_OUTLIER_WINDOW; i++)
+    {
+        sorted[i] = g_outlierWindow[i];
+    }
+    outlier_sortWindow(sorted);
+    median = sorted[HX711_OUTLIER_WINDOW / 2U];
+
+    /* Reuse the buffer for the absolute deviations */
+    for(i = 0; i < HX711_OUTLIER_WINDOW; i++)
+    {
+        sorted[i] = (sorted[i] > median) ? (sorted[i] - median) : (median - sorted[i]);
+    }
+    outlier_sortWindow(sorted);
+
+    threshold = (sorted[HX711_OUTLIER_WINDOW / 2U] * (3L * HX711_OUTLIER_K)) >> 1;
+    if(threshold < g_outlierFloor)
+    {
+        threshold = g_outlierFloor;
+    }
+
+    diff = (raw > median) ? (raw - median) : (median - raw);
+    if(diff > threshold)
+    {
+        if(g_outlierRejected < 0xFFFFU)
+        {
+            g_outlierRejected++;
+        }
+        return median;
+    }
+
+    return raw;
+}
+
+/*
+ * Comb: running mean over the notch length, rounded. The first sample
+ * fills the window so there is no ramp from zero.
+ */
+static sint32 notch_apply(HX711_Notch_t *notch, sint32 raw)
+{
+    uint8 i;
+
+    if(!notch->primed)
+    {
+        for(i = 0; i < HX711_NOTCH_LENGTH; i++)
+        {
+            notch->window[i] = raw;
+        }
+        notch->sum    = raw * (sint32)HX711_NOTCH_LENGTH;
+        notch->index  = 0;
+        notch->primed = 1;
+    }
+
+    notch->sum += raw - notch->window[notch->index];
+    notch->window[notch->index] = raw;
+    notch->index = (uint8)((notch->index + 1U) & (HX711_NOTCH_LENGTH - 1U));
+
+    return (notch->sum + (sint32)(HX711_NOTCH_LENGTH >> 1)) >> HX711_NOTCH_LENGTH_LOG2;
+}
+
+/*
+ * Sum 2^k samples and emit one with k/2 extra fractional bits.
+ */
+static void decimate_update(sint32 raw)
+{
+    if(g_decimateLog2 == 0U)
+    {
+        return;
+    }
+
+    g_decimateAcc += raw;
+    g_decimateCount++;
+
+    if(g_decimateCount >= (uint8)(1U << g_decimateLog2))
+    {
+        uint8 shift = (uint8)(g_decimateLog2 - (g_decimateLog2 >> 1));
+
+        /* Round to nearest instead of flooring half an output LSB away */
+        g_decimated      = (g_decimateAcc + (1L << (shift - 1U))) >> shift;
+        g_decimatedReady = 1;
+        g_decimateAcc    = 0;
+        g_decimateCount  = 0;
+    }
+}
+
+/*
+ * Restart the Kalman estimate at a sample: weight known to one
+ * measurement variance, rate zero with the same (normalised) uncertainty.
+ */
+static void kalman_restart(sint32 raw)
+{
+    g_kalWeight = raw * 16L;
+    g_kalRate   = 0;
+    g_kalP00    = HX711_KALMAN_ONE;
+    g_kalP01    = 0;
+    g_kalP11    = HX711_KALMAN_ONE;
+}
+
+/*
+ * One predict/update step. With P normalised by R the innovation variance
+ * is s = P00 + 1, so (1 - K0) = 1/s and K1 = P01/s; a single division
+ * gives 1/s in Q16 and everything else is multiply/shift.
+ */
+static sint32 filter_kalman(sint32 raw)
+{
+    sint32 innovation;
+    sint32 s;
+    sint32 invS;
+    sint32 gain1;
+
+    /* Predict */
+    g_kalWeight += (g_kalRate + (1L << 11)) >> 12;
+    g_kalP00    += 2L * g_kalP01 + g_kalP11 + g_kalQWeight;
+    g_kalP01    += g_kalP11;
+    g_kalP11    += g_kalQRate;
+
+    if(g_kalP00 > HX711_KALMAN_P_MAX)
+    {
+        g_kalP00 = HX711_KALMAN_P_MAX;
+    }
+
+    /* Innovation, gated against the predicted spread */
+    innovation = raw - ((g_kalWeight + 8L) >> 4);
+    s          = g_kalP00 + HX711_KALMAN_ONE;
+
+    if(((sint64)innovation * innovation) > ((g_kalGateSq * s) >> 24))
+    {
+        kalman_restart(raw);
+        return raw;
+    }
+
+    invS  = (sint32)(0xFFFFFFFFUL / (uint32)(s >> 8));     /* 1/s, Q16 */
+    gain1 = (sint32)(((sint64)g_kalP01 * invS) >> 16);      /* K1, Q24  */
+
+    /* Update: K0 = 1 - 1/s */
+    g_kalWeight += (sint32)(((sint64)innovation * 16L * (65536L - invS)) >> 16);
+    g_kalRate   += (sint32)(((sint64)innovation * gain1) >> 8);
+
+    g_kalP11 -= (sint32)(((sint64)gain1 * g_kalP01) >> 24);
+    g_kalP00  = (sint32)(((sint64)g_kalP00 * invS) >> 16);
+    g_kalP01  = (sint32)(((sint64)g_kalP01 * invS) >> 16);
+
+    if(g_kalP11 < 0)
+    {
+        g_kalP11 = 0;
+    }
+
+    return (g_kalWeight + 8L) >> 4;
+}
+
+/*
+ * Track the peak-to-peak spread of the most recent raw samples and latch
+ * the filtered value on the transition into the stable state.
+ */
+static void stability_update(sint32 raw)
+{
+    sint32 minRaw;
+    sint32 maxRaw;
+    uint8  wasStable = g_isStable;
+    uint8  i;
+
+    g_stableWindow[g_stableIndex] = raw;
+    g_stableIndex++;
+    if(g_stableIndex >= HX711_STABLE_WINDOW)
+    {
+        g_stableIndex = 0;
+    }
+
+    if(g_stableCount < HX711_STABLE_WINDOW)
+    {
+        g_stableCount++;
+        g_isStable = 0;
+        return;
+    }
+
+    minRaw = g_stableWindow[0];
+    maxRaw = g_stableWindow[0];
+    for(i = 1; i < HX711_STABLE_WINDOW; i++)
+    {
+        if(g_stableWindow[i] < minRaw)
+            minRaw = g_stableWindow[i];
+        else if(g_stableWindow[i] > maxRaw)
+            maxRaw = g_stableWindow[i];
+    }
+
+    g_stableSpread = maxRaw - minRaw;
+    g_isStable     = (g_stableSpread <= g_stableThreshold) ? 1U : 0U;
+
+    if(g_isStable && !wasStable)
+    {
+        g_stableLatchedRaw = g_filteredRaw;
+        g_stableLatched    = 1;
+    }
+}
+
+/*
+ * Forget the settling history; called when motion starts.
+ */
+static void predict_restart(void)
+{
+    g_predBlockSum   = 0;
+    g_predBlockCount = 0;
+    g_predMeanCount  = 0;
+    g_predConfident  = 0;
+    g_predAgreeRun   = 0;
+}
+
+/*
+ * Feed one sample to the settling predictor. For an exponential approach
+ * m[n] = F + A*r^n, three equally spaced means give
+ *   F = m2 - d2^2 / (d2 - d1),  d1 = m1 - m0, d2 = m2 - m1.
+ * The 64-bit division runs once per block, not per displayed value.
+ */
+static void predict_update(sint32 raw, uint8 wasStable)
+{
+    sint32 d1;
+    sint32 d2;
+    sint32 absD1;
+    sint32 absD2;
+    sint32 predicted;
+
+    if(g_isStable)
+    {
+        g_predRaw       = g_filteredRaw;
+        g_predConfident = 1;
+        return;
+    }
+
+    if(wasStable)
+    {
+        predict_restart();
+    }
+
+    g_predBlockSum += raw;
+    g_predBlockCount++;
+    if(g_predBlockCount < (1U << HX711_PREDICT_BLOCK_LOG2))
+    {
+        if(g_predMeanCount == 0U)
+        {
+            g_predRaw = raw;
+        }
+        return;
+    }
+
+    g_predMeans[0] = g_predMeans[1];
+    g_predMeans[1] = g_predMeans[2];
+    g_predMeans[2] = g_predBlockSum >> HX711_PREDICT_BLOCK_LOG2;
+    g_predBlockSum   = 0;
+    g_predBlockCount = 0;
+
+    if(g_predMeanCount < 3U)
+    {
+        g_predMeanCount++;
+    }
+
+    if(g_predMeanCount < 3U)
+    {
+        g_predRaw       = g_predMeans[2];
+        g_predConfident = 0;
+        return;
+    }
+
+    d1 = g_predMeans[1] - g_predMeans[0];
+    d2 = g_predMeans[2] - g_predMeans[1];
+    absD1 = (d1 < 0) ? -d1 : d1;
+    absD2 = (d2 < 0) ? -d2 : d2;
+
+    if(absD2 <= g_predAgree)
+    {
+        /* Already flat within the agreement band */
+        predicted = g_predMeans[2];
+    }
+    else if(((d1 < 0) == (d2 < 0)) && (absD2 < (absD1 - (absD1 >> 3))))
+    {
+        predicted = g_predMeans[2] - (sint32)(((sint64)d2 * d2) / (d2 - d1));
+    }
+    else
+    {
+        /* Not converging (still oscillating or load still changing) */
+        g_predRaw       = g_predMeans[2];
+        g_predConfident = 0;
+        g_predAgreeRun  = 0;
+        return;
+    }
+
+    if((g_predAgreeRun > 0U) &&
+       ((predicted - g_predRaw) <= g_predAgree) &&
+       ((g_predRaw - predicted) <= g_predAgree))
+    {
+        if(g_predAgreeRun < 0xFFU)
+        {
+            g_predAgreeRun++;
+        }
+    }
+    else
+    {
+        g_predAgreeRun = 1;
+    }
+
+    g_predRaw       = predicted;
+    g_predConfident = (g_predAgreeRun > HX711_PREDICT_AGREE_RUN) ? 1U : 0U;
+}
+
+/*
+ * Nudge the offset towards the current unloaded reading, bounded around
+ * the calibrated reference.
+ */
+static void zeroTrack_update(void)
+{
+    sint32 error;
+    sint32 newOffset;
+
+    if(!g_zeroTrackEnabled || !g_isStable)
+    {
+        return;
+    }
+
+    error = g_filteredRaw - g_offset;
+    if((error > g_zeroTrackWindow) || (error < -g_zeroTrackWindow))
+    {
+        /* Something is on the platter */
+        return;
+    }
+
+    newOffset = g_offset + (error / (1L << HX711_ZERO_TRACK_SHIFT));
+
+    if((newOffset - g_zeroReference > g_zeroTrackLimit) ||
+       (g_zeroReference - newOffset > g_zeroTrackLimit))
+    {
+        return;
+    }
+
+    g_offset = newOffset;
+}
+
+#if HX711_MULTI_CELL_ENABLED
+/*
+ * Clock one conversion out of every cell at once. Each SCK pulse snapshots
+ * the whole DOUT port; the bits are sorted into per-cell words after
+ * interrupts are back on, so the masked window is no longer than a
+ * single-cell read. All DOUT lines must already be low.
+ */
+static void multi_shiftInAll(sint32 *raw)
+{
+    uint8 snapshot[24];
+    uint8 bit;
+    uint8 cell;
+
+    HX711_READ_CRITICAL_BEGIN();
+
+    for(bit = 0; bit < 24U; bit++)
+    {
+        HX711_SCK_HIGH();
+        _delay_us(HX711_PULSE_DELAY_US);
+
+        snapshot[bit] = HX711_MULTI_DOUT_PIN;
+
+        HX711_SCK_LOW();
+        _delay_us(HX711_PULSE_DELAY_US);
+    }
+
+    /* Every chip sees the same pulses, so they all take the same gain */
+    hx711_gainPulses(g_gain);
+
+    HX711_READ_CRITICAL_END();
+
+    for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+    {
+        uint8  mask  = (uint8)(1U << g_cellPinNum[cell]);
+        uint32 value = 0;
+
+        for(bit = 0; bit < 24U; bit++)
+        {
+            value <<= 1;
+            if(snapshot[bit] & mask)
+            {
+                value |= 1UL;
+            }
+        }
+
+        /* Sign extension */
+        if(value & 0x00800000UL)
+        {
+            value |= 0xFF000000UL;
+        }
+
+        raw[cell] = (sint32)value;
+    }
+}
+#endif
+
+/*---------------------------------------------------------------------------------
+ * PUBLIC FUNCTION IMPLEMENTATIONS
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Initialize HX711 driver.
+ * gain  : HX711_GAINCHANNELA128, HX711_GAINCHANNELA64, HX711_GAINCHANNELB32
+ * scale : scale factor (counts per kg)
+ * offset: tare offset (raw value at 0 kg)
+ */
+void hx711_init(uint8 gain, double scale, sint32 offset)
+{
+    /* Store scale and offset */
+    g_scale  = (scale  == 0.0) ? 1.0 : scale;
+    g_offset = offset;
+    g_zeroReference = offset;
+    hx711_updateScaleDerived();
+
+    /* Set gain pulses and value */
+    switch(gain)
+    {
+        case HX711_GAINCHANNELA128:
+            g_gain      = 1;
+            g_gainValue = 128;
+            break;
+
+        case HX711_GAINCHANNELA64:
+            g_gain      = 3;
+            g_gainValue = 64;
+            break;
+
+        case HX711_GAINCHANNELB32:
+            g_gain      = 2;
+            g_gainValue = 32;
+            break;
+
+        default:
+            g_gain      = 1;
+            g_gainValue = 128;
+            break;
+    }
+
+#if HX711_AUTORANGE_ENABLED
+    /* The chip comes out of reset on channel A / 128 */
+    g_autoRange     = 0;
+    g_convPulses    = HX711_PULSES_A128;
+    g_rangeSwitched = 0;
+#endif
+
+    /* Configure pins */
+    SET_BIT(HX711_SCK_DDR, HX711_SCK_PINNUM);    /* SCK as output  */
+    HX711_SCK_LOW();
+
+    CLEAR_BIT(HX711_DOUT_DDR, HX711_DOUT_PINNUM);/* DOUT as input  */
+    SET_BIT(HX711_DOUT_PORT, HX711_DOUT_PINNUM); /* pull-up enable */
+
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+    SET_BIT(HX711_SPI_SS_DDR, HX711_SPI_SS_PINNUM); /* SS as output   */
+#endif
+
+    _delay_ms(200);
+
+    /* Reset simulation state */
+    g_simPatternActive = 0;
+    g_simTicksMs       = 0;
+}
+
+/*
+ * Check if HX711 is ready (DOUT low).
+ */
+uint8 hx711_isready(void)
+{
+    return (HX711_DOUT_READ() == 0) ? 1U : 0U;
+}
+
+/*
+ * Blocking read behind every averaging path: waits at most
+ * HX711_NO_DATA_TIMEOUT_MS for the next delivered sample (buffered by the
+ * ISR or polled), so a dead or unplugged chip raises HX711_FAULT_NO_DATA and
+ * the caller gives up instead of hanging. Returns 0 on timeout.
+ */
+static uint8 hx711_readBounded(sint32 *value)
+{
+    HX711_Status_t status = hx711_readTimeout(value, HX711_NO_DATA_TIMEOUT_MS);
+
+    if((status != HX711_STATUS_OK) && (status != HX711_STATUS_SATURATED))
+    {
+        return 0U;
+    }
+
+    g_lastRaw = *value;
+
+    return 1U;
+}
+
+/*
+ * Read a single raw value from HX711 or from simulation. Waits at most
+ * HX711_NO_DATA_TIMEOUT_MS; on timeout HX711_FAULT_NO_DATA is raised and
+ * the previous sample is returned again.
+ */
+sint32 hx711_read(void)
+{
+    sint32 value;
+
+    return hx711_readBounded(&value) ? value : g_lastRaw;
+}
+
+/*
+ * Average multiple raw HX711 readings. Power-of-two counts are cheapest
+ * (see hx711_averageSum()); more than HX711_AVERAGE_MAX_SAMPLES (127 with
+ * auto-ranging) are clamped so the sum cannot overflow. Stops at the first
+ * read that times out and averages what it has (HX711_FAULT_NO_DATA tells
+ * the caller).
+ */
+sint32 hx711_readaverage(uint8 times)
+{
+    sint32 sum = 0;
+    sint32 raw;
+    uint8  i;
+
+    if(times == 0U)
+        times = 1U;
+#if (HX711_SAMPLE_BITS > 24)
+    if(times > HX711_AVERAGE_MAX_SAMPLES)
+        times = HX711_AVERAGE_MAX_SAMPLES;
+#endif
+
+#if HX711_ISR_ACQUISITION_ENABLED
+    /* Average fresh conversions, not what queued up before the call */
+    g_sampleTail = g_sampleHead;
+#endif
+
+    for(i = 0; i < times; i++)
+    {
+        if(!hx711_readBounded(&raw))
+        {
+            break;
+        }
+        sum += raw;
+        _delay_ms(5);
+    }
+
+    return (i > 0U) ? hx711_averageSum(sum, i) : g_lastRaw;
+}
+
+/*
+ * Average readings until the standard error of the mean is at most
+ * targetMilligrams (at the current scale) or maxSamples were taken.
+ * Samples are kept relative to the first one so the 1/16-count mean fits
+ * in 32 bits. A read that times out ends the average early, unconverged,
+ * with HX711_FAULT_NO_DATA raised.
+ */
+uint8 hx711_readPreciseAverage(uint16 targetMilligrams, uint8 maxSamples,
+                               HX711_AverageResult_t *result)
+{
+    sint32 origin;
+    sint32 meanQ4 = 0;          /* running mean, 1/16 count            */
+    uint64 m2     = 0;          /* sum of squared deviations, 1/256    */
+    uint64 targetSq;            /* target^2, 1/256 count^2             */
+    uint32 semSq;
+    double targetQ4;
+    uint8  n = 0;
+    uint8  converged = 0;
+
+    if(maxSamples < HX711_PRECISE_MIN_SAMPLES)
+    {
+        maxSamples = HX711_PRECISE_MIN_SAMPLES;
+    }
+
+    /* Target in 1/16 counts, computed once */
+    targetQ4 = (double)targetMilligrams * 16.0 * ((g_scale < 0.0) ? -g_scale : g_scale) / 1000000.0;
+    targetSq = (uint64)(targetQ4 * targetQ4);
+
+#if HX711_ISR_ACQUISITION_ENABLED
+    /*
+     * Queued samples may predate the load now on the platter (the weight
+     * placed for calibration); start from conversions after the call.
+     */
+    g_sampleTail = g_sampleHead;
+#endif
+
+    if(!hx711_readBounded(&origin))
+    {
+        origin = g_lastRaw;
+        maxSamples = 0;
+    }
+
+    while(n < maxSamples)
+    {
+        sint32 xQ4 = 0;
+        sint32 delta;
+        sint64 term;
+
+        if(n > 0U)
+        {
+            sint32 raw;
+
+            if(!hx711_readBounded(&raw))
+            {
+                break;
+            }
+            xQ4 = (raw - origin) * 16L;
+        }
+        n++;
+
+        /* Welford: mean += delta / n; M2 += delta * (x - new mean) */
+        delta   = xQ4 - meanQ4;
+        meanQ4 += delta / (sint32)n;
+        term    = (sint64)delta * (xQ4 - meanQ4);
+        if(term > 0)
+        {
+            m2 += (uint64)term;   /* >= 0 exactly; truncation can dip below */
+        }
+
+        if((n >= HX711_PRECISE_MIN_SAMPLES) &&
+           (m2 <= targetSq * n * (uint64)(n - 1U)))
+        {
+            converged = 1;
+            break;
+        }
+    }
+
+    if(result != NULL)
+    {
+        uint64 sem2 = (n > 1U) ? m2 / ((uint64)n * (n - 1U)) : 0U;
+
+        semSq = (sem2 > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32)sem2;
+
+        result->mean          = origin + ((meanQ4 + ((meanQ4 < 0) ? -8 : 8)) / 16L);
+        result->samples       = n;
+        result->semMilligrams = (uint32)((double)hx711_isqrt(semSq) * 1000000.0 /
+                                         (16.0 * ((g_scale < 0.0) ? -g_scale : g_scale)));
+        result->converged     = converged;
+    }
+
+    return converged;
+}
+
+/*
+ * Sample count and precision reached by the last tare, calibration or
+ * calibration-point capture.
+ */
+void hx711_getLastAverageResult(HX711_AverageResult_t *result)
+{
+    if(result != NULL)
+    {
+        *result = g_lastAverage;
+    }
+}
+
+/*
+ * Start interrupt-driven acquisition: every DOUT falling edge (data ready)
+ * is serviced by the pin-change ISR and the sample queued for the consumer.
+ * The caller's interrupt state is preserved; global interrupts are enabled
+ * by the application once everything is armed.
+ */
+void hx711_startAcquisition(void)
+{
+#if HX711_ISR_ACQUISITION_ENABLED
+    uint8 sreg = SREG;
+
+    cli();
+
+    g_sampleHead     = 0;
+    g_sampleTail     = 0;
+    g_sampleOverruns = 0;
+
+    SET_BIT(HX711_DOUT_PCMSK, HX711_DOUT_PCINT);
+    PCIFR = (1U << HX711_DOUT_PCIFR_BIT);
+    SET_BIT(PCICR, HX711_DOUT_PCICR_BIT);
+
+    g_acquisitionActive = 1;
+
+    /*
+     * A conversion that is already waiting will not produce another edge,
+     * so collect it here to get the ISR cadence going.
+     */
+    if(!g_simulationEnabled && hx711_isready())
+    {
+        sint32 sample = hx711_shiftInSample();
+
+        if(hx711_routeSample(&sample))
+        {
+            g_sampleBuffer[0] = sample;
+#if HX711_TIMING_ENABLED
+            g_sampleStamp[0]  = g_lastStamp;
+#endif
+            g_sampleHead      = 1;
+        }
+        PCIFR = (1U << HX711_DOUT_PCIFR_BIT);
+    }
+
+    SREG = sreg;
+#endif
+}
+
+/*
+ * Stop interrupt-driven acquisition and return to polled reads.
+ */
+void hx711_stopAcquisition(void)
+{
+#if HX711_ISR_ACQUISITION_ENABLED
+    CLEAR_BIT(HX711_DOUT_PCMSK, HX711_DOUT_PCINT);
+    g_acquisitionActive = 0;
+#endif
+}
+
+/*
+ * Return 1 while the pin-change ISR is collecting samples.
+ */
+uint8 hx711_isAcquisitionActive(void)
+{
+#if HX711_ISR_ACQUISITION_ENABLED
+    return g_acquisitionActive;
+#else
+    return 0U;
+#endif
+}
+
+/*
+ * Non-blocking sample fetch.
+ * Returns 1 and stores the sample if one is available, 0 otherwise.
+ * Without active acquisition the HX711 is read directly when DOUT is low.
+ */
+uint8 hx711_tryGetSample(sint32 *sample)
+{
+    sint32 value;
+
+    if(sample == NULL)
+    {
+        return 0U;
+    }
+
+    if(g_simulationEnabled)
+    {
+        *sample = hx711_read_simulated();
+        return 1U;
+    }
+
+    hx711_wake();
+
+#if HX711_ISR_ACQUISITION_ENABLED
+    if(g_acquisitionActive)
+    {
+        uint8 tail = g_sampleTail;
+
+        if(tail == g_sampleHead)
+        {
+            return 0U;
+        }
+
+        /* Slot is not reused by the ISR until the tail moves past it */
+        *sample      = g_sampleBuffer[tail];
+        g_sampleTail = (uint8)((tail + 1U) & HX711_SAMPLE_BUFFER_MASK);
+
+        return 1U;
+    }
+#endif
+
+    if(!hx711_isready())
+    {
+        return 0U;
+    }
+
+    HX711_READ_CRITICAL_BEGIN();
+    value = hx711_shiftInSample();
+    HX711_READ_CRITICAL_END();
+
+    if(!hx711_routeSample(&value))
+    {
+        return 0U;
+    }
+
+    *sample = value;
+
+    return 1U;
+}
+
+/*
+ * Number of samples that can be fetched without blocking.
+ */
+uint8 hx711_getPendingSamples(void)
+{
+    if(g_simulationEnabled)
+    {
+        return 1U;
+    }
+
+#if HX711_ISR_ACQUISITION_ENABLED
+    if(g_acquisitionActive)
+    {
+        return (uint8)((g_sampleHead - g_sampleTail) & HX711_SAMPLE_BUFFER_MASK);
+    }
+#endif
+
+    return hx711_isready();
+}
+
+/*
+ * Number of conversions dropped because the ring buffer was full.
+ */
+uint8 hx711_getOverrunCount(void)
+{
+#if HX711_ISR_ACQUISITION_ENABLED
+    return g_sampleOverruns;
+#else
+    return 0U;
+#endif
+}
+
+#if HX711_TIMING_ENABLED
+/*
+ * Stamp the conversion just routed and fold the interval since the
+ * previous one into the cadence statistics (routing context).
+ */
+static void timing_update(void)
+{
+    uint16 now;
+    uint16 interval;
+
+    if(!g_timingActive)
+    {
+        return;
+    }
+
+    now = TCNT1;
+
+    if(g_timingResync)
+    {
+        g_timingResync = 0;
+        g_lastStamp    = now;
+        return;
+    }
+
+    interval    = (uint16)(now - g_lastStamp);
+    g_lastStamp = now;
+
+    if(interval < g_intervalMin)
+    {
+        g_intervalMin = interval;
+    }
+    if(interval > g_intervalMax)
+    {
+        g_intervalMax = interval;
+    }
+
+    /* Keep the mean running: halve both once the count saturates */
+    if(g_intervalCount == 0xFFFFU)
+    {
+        g_intervalSum   >>= 1;
+        g_intervalCount >>= 1;
+    }
+    g_intervalSum += interval;
+    g_intervalCount++;
+
+    if(interval > (uint16)(HX711_NOMINAL_INTERVAL_TICKS + (HX711_NOMINAL_INTERVAL_TICKS >> 1)))
+    {
+        uint16 skipped = (uint16)(((uint32)interval + (HX711_NOMINAL_INTERVAL_TICKS >> 1)) /
+                                  HX711_NOMINAL_INTERVAL_TICKS) - 1U;
+
+        g_missedSamples = ((uint32)g_missedSamples + skipped > 0xFFFFUL) ? 0xFFFFU
+                                                                         : (uint16)(g_missedSamples + skipped);
+    }
+}
+#endif
+
+#if HX711_AUTORANGE_ENABLED
+/*
+ * Called with the gain pulses about to be sent after every read: remembers
+ * the gain the sample just shifted in was converted at and flags the first
+ * conversion after a gain change as settling.
+ */
+static void autorange_schedule(uint8 pulses)
+{
+    g_samplePulses  = g_convPulses;
+    g_rangeSettling = g_rangeSwitched;
+    g_rangeSwitched = (pulses != g_convPulses) ? 1U : 0U;
+    g_convPulses    = pulses;
+}
+
+/*
+ * Channel A part of routing: drop settling samples, pick the gain for the
+ * following conversions and map gain 64 samples into gain 128 counts.
+ * Returns 1 when *raw should be delivered.
+ */
+static uint8 autorange_apply(sint32 *raw)
+{
+    sint32 value = *raw;
+    sint32 magnitude;
+    sint64 mapped;
+    uint8  railed;
+
+    if(g_rangeSettling)
+    {
+        return 0U;
+    }
+
+    /* Fixed gain: nothing converted at another gain gets through */
+    if(!g_autoRange)
+    {
+        return (g_samplePulses == g_gain) ? 1U : 0U;
+    }
+
+    magnitude = (value < 0) ? -value : value;
+    railed    = ((value == HX711_RAW_MAX) || (value == HX711_RAW_MIN)) ? 1U : 0U;
+
+    if(g_samplePulses == HX711_PULSES_A128)
+    {
+        if((magnitude >= HX711_AUTORANGE_HIGH_COUNTS) && (g_gain == HX711_PULSES_A128))
+        {
+            g_gain      = HX711_PULSES_A64;
+            g_gainValue = HX711_GAINCHANNELA64;
+        }
+
+        /* A clipped reading would pull the filters off; gain 64 follows */
+        if(railed)
+        {
+            return 0U;
+        }
+
+        return 1U;
+    }
+
+    if((magnitude <= HX711_AUTORANGE_LOW_COUNTS) && (g_gain == HX711_PULSES_A64))
+    {
+        g_gain      = HX711_PULSES_A128;
+        g_gainValue = HX711_GAINCHANNELA128;
+    }
+
+    /* Overload at gain 64 too: pass the rail code on for fault handling */
+    if(railed)
+    {
+        return 1U;
+    }
+
+    mapped = g_rangeBias + (((sint64)value * g_rangeRatio + (1L << 15)) >> 16);
+
+    /* Only a calibrated ratio well above 2 or a large zero gets here */
+    if(mapped > HX711_MAPPED_MAX)
+    {
+        mapped = HX711_MAPPED_MAX;
+    }
+    else if(mapped < HX711_MAPPED_MIN)
+    {
+        mapped = HX711_MAPPED_MIN;
+    }
+    *raw = (sint32)mapped;
+
+    return 1U;
+}
+
+/*
+ * Rebuild the gain 64 -> 128 mapping from the stored calibration pair,
+ * falling back to the nominal ratio without one. The bias always comes from
+ * the stored zeros; with no gain 64 zero measured both are 0 and the
+ * offset is taken to scale with the gain, i.e. zero64 = zero128 / 2.
+ */
+static void autorange_updateMapping(void)
+{
+    sint32 ratio = HX711_AUTORANGE_NOMINAL_RATIO;
+    sint32 bias;
+    uint8  sreg;
+
+    if(g_lowGainScale != 0.0)
+    {
+        double r = g_scale / g_lowGainScale;
+
+        if((r * 65536.0 >= (double)HX711_AUTORANGE_MIN_RATIO) &&
+           (r * 65536.0 <= (double)HX711_AUTORANGE_MAX_RATIO))
+        {
+            ratio = (sint32)(r * 65536.0 + 0.5);
+        }
+        else
+        {
+            /* Implausible pair (mixed-up or partial calibration) */
+            g_lowGainScale = 0.0;
+        }
+    }
+
+    bias = g_lowGainZero - (sint32)(((sint64)g_lowGainOffset * ratio + (1L << 15)) >> 16);
+
+    sreg = SREG;
+    cli();
+    g_rangeRatio = ratio;
+    g_rangeBias  = bias;
+    SREG = sreg;
+}
+
+/*
+ * Average the current load at gain 64 with auto-ranging held off, then
+ * return to gain 128. Used by the calibration steps. Returns 0 when the
+ * HX711 stopped answering.
+ */
+static uint8 autorange_captureLowGain(sint32 *average)
+{
+    uint8 savedAutoRange = g_autoRange;
+    uint8 sreg;
+    uint8 ok;
+
+    sreg = SREG;
+    cli();
+    g_autoRange = 0;
+    g_gain      = HX711_PULSES_A64;
+    g_gainValue = HX711_GAINCHANNELA64;
+    SREG = sreg;
+
+    /* The average starts by dropping queued gain 128 samples */
+    ok = hx711_calibrationAverage(average);
+
+    sreg = SREG;
+    cli();
+    g_gain      = HX711_PULSES_A128;
+    g_gainValue = HX711_GAINCHANNELA128;
+    g_autoRange = savedAutoRange;
+    SREG = sreg;
+
+#if HX711_ISR_ACQUISITION_ENABLED
+    g_sampleTail = g_sampleHead;
+#endif
+
+    return ok;
+}
+#endif
+
+#if HX711_RECORDER_ENABLED
+/*
+ * Store one byte at the head of the recorder ring; room was made already.
+ */
+static void recorder_put(uint8 value)
+{
+    g_recRing[g_recHead] = value;
+    g_recHead = (uint8)((g_recHead + 1U) & HX711_RECORDER_MASK);
+    g_recUsed++;
+}
+
+/*
+ * Drop the oldest record, folding it into the base the next one applies to.
+ */
+static void recorder_dropOldest(void)
+{
+    uint8 code = g_recRing[g_recTail];
+    uint8 length;
+
+    if(code == HX711_SIM_TRACE_ESCAPE)
+    {
+        /* Sign from the top byte, so host builds with a wider long agree */
+        g_recBaseRaw = (sint32)(sint8)g_recRing[(g_recTail + 1U) & HX711_RECORDER_MASK] * 0x1000000L +
+                       (sint32)(((uint32)g_recRing[(g_recTail + 2U) & HX711_RECORDER_MASK] << 16) |
+                                ((uint32)g_recRing[(g_recTail + 3U) & HX711_RECORDER_MASK] << 8)  |
+                                ((uint32)g_recRing[(g_recTail + 4U) & HX711_RECORDER_MASK]));
+        g_recBaseTick++;
+        length = 5U;
+    }
+    else if(code == HX711_SIM_TRACE_GAP)
+    {
+        uint8 count = g_recRing[(g_recTail + 1U) & HX711_RECORDER_MASK];
+
+        if(count == 0U)
+        {
+            g_recBaseTick += ((uint32)g_recRing[(g_recTail + 2U) & HX711_RECORDER_MASK] << 24) |
+                             ((uint32)g_recRing[(g_recTail + 3U) & HX711_RECORDER_MASK] << 16) |
+                             ((uint32)g_recRing[(g_recTail + 4U) & HX711_RECORDER_MASK] << 8)  |
+                             ((uint32)g_recRing[(g_recTail + 5U) & HX711_RECORDER_MASK]);
+            length = 6U;
+        }
+        else
+        {
+            g_recBaseTick += count;
+            length = 2U;
+        }
+    }
+    else
+    {
+        g_recBaseRaw += (sint8)code;
+        g_recBaseTick++;
+        length = 1U;
+    }
+
+    g_recTail  = (uint8)((g_recTail + length) & HX711_RECORDER_MASK);
+    g_recUsed -= length;
+}
+
+/*
+ * Record a delivered sample (routing context, ISR or main). Frozen while a
+ * dump is streaming.
+ */
+static void recorder_append(sint32 raw)
+{
+    uint32 gap;
+    sint32 delta;
+    uint8  absolute;
+    uint8  needed;
+
+    if(!g_recEnabled || g_recDumping)
+    {
+        return;
+    }
+
+    gap   = g_recTick - g_recLastTick - 1UL;
+    delta = raw - g_recLastRaw;
+
+    absolute = (g_recUsed == 0U) || (delta < -126) || (delta > 127);
+
+    needed = (gap > 0xFFUL) ? 6U : ((gap > 0UL) ? 2U : 0U);
+    needed += absolute ? 5U : 1U;
+
+    while((uint16)(g_recUsed + needed) > HX711_RECORDER_BYTES)
+    {
+        recorder_dropOldest();
+    }
+
+    if(g_recUsed == 0U)
+    {
+        /* Empty ring: the base is simply the record before this one */
+        g_recBaseTick = g_recTick - 1UL;
+        g_recBaseRaw  = raw;
+        gap           = 0;
+        absolute      = 1U;
+    }
+
+    if(gap > 0UL)
+    {
+        recorder_put(HX711_SIM_TRACE_GAP);
+        if(gap > 0xFFUL)
+        {
+            recorder_put(0U);
+            recorder_put((uint8)(gap >> 24));
+            recorder_put((uint8)(gap >> 16));
+            recorder_put((uint8)(gap >> 8));
+        }
+        recorder_put((uint8)gap);
+    }
+
+    if(absolute)
+    {
+        recorder_put(HX711_SIM_TRACE_ESCAPE);
+        recorder_put((uint8)((uint32)raw >> 24));
+        recorder_put((uint8)((uint32)raw >> 16));
+        recorder_put((uint8)((uint32)raw >> 8));
+        recorder_put((uint8)raw);
+    }
+    else
+    {
+        recorder_put((uint8)(sint8)delta);
+    }
+
+    g_recLastTick = g_recTick;
+    g_recLastRaw  = raw;
+}
+#endif
+
+/*
+ * Add time spent waiting without data to the no-data total and report
+ * whether the fault timeout has been reached.
+ */
+static HX711_Status_t fault_noData(uint16 waitedMs)
+{
+    if(((uint32)g_noDataMs + waitedMs) > 0xFFFFUL)
+    {
+        g_noDataMs = 0xFFFFU;
+    }
+    else
+    {
+        g_noDataMs += waitedMs;
+    }
+
+    if(g_noDataMs < HX711_NO_DATA_TIMEOUT_MS)
+    {
+        return HX711_STATUS_NOT_READY;
+    }
+
+    /* A chip stopped by a stray SCK high comes back from here */
+    hx711_releaseSck();
+
+    return HX711_STATUS_TIMEOUT;
+}
+
+/*
+ * Read one sample, waiting at most timeoutMs (0 = only if one is ready).
+ * The sample is stored for HX711_STATUS_OK and HX711_STATUS_SATURATED.
+ */
+HX711_Status_t hx711_readTimeout(sint32 *value, uint16 timeoutMs)
+{
+    uint16 waitedMs = 0;
+
+    if(value == NULL)
+    {
+        return HX711_STATUS_NOT_READY;
+    }
+
+    while(!hx711_tryGetSample(value))
+    {
+        if(waitedMs >= timeoutMs)
+        {
+            return fault_noData(waitedMs);
+        }
+
+        _delay_ms(1);
+        waitedMs++;
+    }
+
+    g_noDataMs = 0;
+
+    return ((*value == HX711_RAW_MAX) || (*value == HX711_RAW_MIN)) ? HX711_STATUS_SATURATED
+                                                                    : HX711_STATUS_OK;
+}
+
+/*
+ * Wait at most timeoutMs until a sample can be fetched without blocking,
+ * without consuming it. Lets a polling loop (keypad + display) notice a
+ * silent HX711 while it keeps running.
+ */
+HX711_Status_t hx711_waitSample(uint16 timeoutMs)
+{
+    uint16 waitedMs = 0;
+
+    while(hx711_getPendingSamples() == 0U)
+    {
+        if(waitedMs >= timeoutMs)
+        {
+            return fault_noData(waitedMs);
+        }
+
+        _delay_ms(1);
+        waitedMs++;
+    }
+
+    g_noDataMs = 0;
+
+    return HX711_STATUS_OK;
+}
+
+/*
+ * Current fault bits (HX711_FAULT_xxx), 0 when the scale is healthy.
+ */
+uint8 hx711_getFaults(void)
+{
+    uint8 faults = 0;
+
+    if(g_noDataMs >= HX711_NO_DATA_TIMEOUT_MS)
+    {
+        faults |= HX711_FAULT_NO_DATA;
+    }
+
+    if(g_railCount >= HX711_FAULT_RAIL_SAMPLES)
+    {
+        faults |= HX711_FAULT_SATURATED;
+    }
+
+    if(g_noisyCount >= HX711_FAULT_NOISE_SAMPLES)
+    {
+        faults |= HX711_FAULT_NOISY;
+    }
+
+    return faults;
+}
+
+/*---------------------------------------------------------------------------------
+ * CHANNEL INTERLEAVING
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Start alternating channel A and channel B runs. The new schedule takes
+ * effect from the next read. Returns 0 when channel A itself was set up on
+ * gain 32 (channel B) by hx711_init() or interleaving is compiled out.
+ */
+uint8 hx711_startInterleave(void)
+{
+#if HX711_INTERLEAVE_ENABLED
+    uint8 sreg;
+
+    if(g_gainValue == HX711_GAINCHANNELB32)
+    {
+        return 0U;
+    }
+
+    sreg = SREG;
+    cli();
+
+    g_channelBHead     = 0;
+    g_channelBTail     = 0;
+    g_interleaveRun    = 0;
+    g_interleaveActive = 1;
+
+    SREG = sreg;
+
+    return 1U;
+#else
+    return 0U;
+#endif
+}
+
+/*
+ * Return to channel A only. A channel B conversion already programmed is
+ * still routed to its queue, and the first channel A sample after it is
+ * dropped as settling.
+ */
+void hx711_stopInterleave(void)
+{
+#if HX711_INTERLEAVE_ENABLED
+    g_interleaveActive = 0;
+#endif
+}
+
+/*
+ * Return 1 while channel A/B runs are being scheduled.
+ */
+uint8 hx711_isInterleaveActive(void)
+{
+#if HX711_INTERLEAVE_ENABLED
+    return g_interleaveActive;
+#else
+    return 0U;
+#endif
+}
+
+/*
+ * Non-blocking fetch from the channel B stream. Samples arrive only while
+ * channel A is being consumed (ISR acquisition, hx711_update() or reads).
+ */
+uint8 hx711_tryGetChannelBSample(sint32 *sample)
+{
+#if HX711_INTERLEAVE_ENABLED
+    uint8 tail = g_channelBTail;
+
+    if((sample == NULL) || (tail == g_channelBHead))
+    {
+        return 0U;
+    }
+
+    *sample        = g_channelBBuffer[tail];
+    g_channelBTail = (uint8)((tail + 1U) & HX711_CHANNEL_B_BUFFER_MASK);
+
+    return 1U;
+#else
+    (void)sample;
+    return 0U;
+#endif
+}
+
+/*---------------------------------------------------------------------------------
+ * STREAMING FILTER
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Select the smoothing filter. History is restarted from the next sample.
+ */
+void hx711_setFilter(HX711_FilterType_t type)
+{
+    g_filterType = type;
+    hx711_resetFilter();
+}
+
+/*
+ * Get the selected smoothing filter.
+ */
+HX711_FilterType_t hx711_getFilter(void)
+{
+    return g_filterType;
+}
+
+/*
+ * Forget filter history; the next sample re-primes all stages. Samples
+ * still queued by the ISR are stale as well and are discarded.
+ */
+void hx711_resetFilter(void)
+{
+    g_filterPrimed = 0;
+
+    g_stableCount  = 0;
+    g_isStable     = 0;
+    g_stableLatched = 0;
+
+    g_decimateAcc    = 0;
+    g_decimateCount  = 0;
+    g_decimatedReady = 0;
+
+    g_outlierCount = 0;
+    g_notch.primed = 0;
+    g_noisyCount   = 0;
+
+    predict_restart();
+
+#if HX711_ISR_ACQUISITION_ENABLED
+    g_sampleTail = g_sampleHead;
+#endif
+}
+
+/*
+ * Push one raw sample through the selected filter.
+ */
+void hx711_feedSample(sint32 raw)
+{
+    uint8 wasStable;
+
+    if(g_outlierEnabled)
+    {
+        raw = outlier_reject(raw);
+    }
+
+    if(g_notchEnabled)
+    {
+        raw = notch_apply(&g_notch, raw);
+    }
+
+    if(!g_filterPrimed)
+    {
+        filter_prime(raw);
+    }
+
+    switch(g_filterType)
+    {
+        case HX711_FILTER_MOVING_AVERAGE:
+            g_filteredRaw = filter_movingAverage(raw);
+            break;
+
+        case HX711_FILTER_MEDIAN:
+            g_filteredRaw = filter_median(raw);
+            break;
+
+        case HX711_FILTER_IIR:
+            g_filteredRaw = filter_iir(raw);
+            break;
+
+        case HX711_FILTER_ADAPTIVE:
+            g_filteredRaw = filter_adaptive(raw);
+            break;
+
+        case HX711_FILTER_KALMAN:
+            g_filteredRaw = filter_kalman(raw);
+            break;
+
+        case HX711_FILTER_NONE:
+        default:
+            g_filteredRaw = raw;
+            break;
+    }
+
+    decimate_update(raw);
+
+    wasStable = g_isStable;
+    stability_update(raw);
+    predict_update(raw, wasStable);
+    zeroTrack_update();
+
+    /* Sustained spread well beyond motion: vibration, EMI, loose wiring */
+    if((g_stableCount >= HX711_STABLE_WINDOW) && (g_stableSpread > g_faultNoiseBand))
+    {
+        if(g_noisyCount < 0xFFU)
+        {
+            g_noisyCount++;
+        }
+    }
+    else
+    {
+        g_noisyCount = 0;
+    }
+}
+
+/*
+ * Feed every sample that is available right now into the filter.
+ * Never blocks. Returns the number of samples consumed.
+ */
+uint8 hx711_update(void)
+{
+    uint8  pending = hx711_getPendingSamples();
+    uint8  count   = 0;
+    sint32 raw;
+
+    while((count < pending) && hx711_tryGetSample(&raw))
+    {
+        hx711_feedSample(raw);
+        count++;
+    }
+
+    return count;
+}
+
+/*
+ * Latest filtered raw value. Blocks only if no sample has been seen since
+ * the last reset, and then at most HX711_NO_DATA_TIMEOUT_MS.
+ */
+sint32 hx711_getFilteredRaw(void)
+{
+    sint32 raw;
+
+    (void)hx711_update();
+
+    if(!g_filterPrimed && hx711_readBounded(&raw))
+    {
+        hx711_feedSample(raw);
+    }
+
+    return g_filteredRaw;
+}
+
+/*
+ * Return 1 once the filter holds at least one sample.
+ */
+uint8 hx711_isFilterPrimed(void)
+{
+    return g_filterPrimed;
+}
+
+/*---------------------------------------------------------------------------------
+ * KALMAN FILTER
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Set the noise model (measurement in mg, process in ug per sample, see
+ * hx711.h). Only the ratios to the measurement noise enter the per-sample
+ * math; the gate follows the scale. A zero measurement noise is rejected.
+ */
+void hx711_setKalmanNoise(uint16 measMg, uint16 weightUg, uint16 rateUg)
+{
+    uint64 measSq;
+
+    if(measMg == 0U)
+    {
+        return;
+    }
+
+    measSq = (uint64)measMg * measMg * 1000000ULL;
+
+    g_kalMeasMg  = measMg;
+    g_kalQWeight = (sint32)((((uint64)weightUg * weightUg) << 24) / measSq);
+    g_kalQRate   = (sint32)((((uint64)rateUg * rateUg) << 24) / measSq);
+
+    hx711_updateScaleDerived();
+}
+
+/*
+ * Rate of change estimated by the Kalman filter, mg per second at
+ * HX711_SAMPLE_RATE_SPS. Zero for the other filter types.
+ */
+sint32 hx711_getRateMilligramsPerSecond(void)
+{
+    if(g_filterType != HX711_FILTER_KALMAN)
+    {
+        return 0;
+    }
+
+    return hx711_countsQToMilligrams(g_kalRate * HX711_SAMPLE_RATE_SPS, g_scaleRecip, 16U);
+}
+
+/*---------------------------------------------------------------------------------
+ * OUTLIER REJECTION
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Run every fed sample through the Hampel stage. The window refills from
+ * scratch, passing samples unchanged until it is full.
+ */
+void hx711_enableOutlierRejection(void)
+{
+    g_outlierCount   = 0;
+    g_outlierEnabled = 1;
+}
+
+void hx711_disableOutlierRejection(void)
+{
+    g_outlierEnabled = 0;
+}
+
+/*
+ * Samples replaced by the window median since the last clear (saturates).
+ */
+uint16 hx711_getRejectedCount(void)
+{
+    return g_outlierRejected;
+}
+
+void hx711_clearRejectedCount(void)
+{
+    g_outlierRejected = 0;
+}
+
+/*---------------------------------------------------------------------------------
+ * MAINS NOTCH (COMB)
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Insert the comb into the sample chain; it refills from the next sample.
+ */
+void hx711_enableNotch(void)
+{
+    g_notch.primed = 0;
+    g_notchEnabled = 1;
+}
+
+void hx711_disableNotch(void)
+{
+    g_notchEnabled = 0;
+}
+
+uint8 hx711_isNotchEnabled(void)
+{
+    return g_notchEnabled;
+}
+
+/*---------------------------------------------------------------------------------
+ * OVERSAMPLING / DECIMATION
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Decimate by 2^log2Samples (0 turns the stage off). Values above
+ * HX711_DECIMATE_MAX_LOG2 are clamped. Restarts the current block.
+ */
+void hx711_setDecimation(uint8 log2Samples)
+{
+    if(log2Samples > HX711_DECIMATE_MAX_LOG2)
+    {
+        log2Samples = HX711_DECIMATE_MAX_LOG2;
+    }
+
+    g_decimateLog2   = log2Samples;
+    g_decimateAcc    = 0;
+    g_decimateCount  = 0;
+    g_decimatedReady = 0;
+}
+
+uint8 hx711_getDecimation(void)
+{
+    return g_decimateLog2;
+}
+
+/*
+ * Non-blocking: returns 1 once per completed block with the decimated
+ * sample (raw counts with hx711_getDecimationFracBits() fractional bits).
+ */
+uint8 hx711_tryGetDecimatedSample(sint32 *sample)
+{
+    (void)hx711_update();
+
+    if((sample == NULL) || !g_decimatedReady)
+    {
+        return 0U;
+    }
+
+    *sample          = g_decimated;
+    g_decimatedReady = 0;
+
+    return 1U;
+}
+
+/*
+ * Fractional bits carried by decimated samples.
+ */
+uint8 hx711_getDecimationFracBits(void)
+{
+    return (uint8)(g_decimateLog2 >> 1);
+}
+
+/*
+ * Effective resolution of the decimated output in bits.
+ */
+uint8 hx711_getEffectiveBits(void)
+{
+    return (uint8)(HX711_NOISE_FREE_BITS + (g_decimateLog2 >> 1));
+}
+
+/*
+ * Decimated output rate in mHz (10 SPS / 16 = 625 mHz).
+ */
+uint32 hx711_getDecimatedRateMilliHz(void)
+{
+    return (HX711_SAMPLE_RATE_SPS * 1000UL) >> g_decimateLog2;
+}
+
+/*
+ * Convert a decimated sample to milligrams, keeping the extra bits: the
+ * tared counts stay in fixed point through the Q32 multiply. Uses the
+ * multi-point table when present.
+ */
+sint32 hx711_decimatedToMilligrams(sint32 sample)
+{
+    uint8  frac    = (uint8)(g_decimateLog2 >> 1);
+    sint32 countsQ = sample - (g_offset * (1L << frac));
+    sint32 baseMg  = 0;
+    sint32 recip   = g_scaleRecip;
+
+    if(g_calCount > 1U)
+    {
+        uint8 lo = calibration_segment(countsQ >> frac);
+
+        baseMg   = g_calGrams[lo] * HX711_GRAMS_PER_KG;
+        countsQ -= g_calCounts[lo] * (1L << frac);
+        recip    = g_calSlope[lo];
+    }
+
+    return baseMg + hx711_countsQToMilligrams(countsQ, recip, frac);
+}
+
+/*---------------------------------------------------------------------------------
+ * STABILITY DETECTION
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Return 1 while the last HX711_STABLE_WINDOW samples sit within the band.
+ */
+uint8 hx711_isStable(void)
+{
+    (void)hx711_update();
+
+    return g_isStable;
+}
+
+/*
+ * Weight (grams, clamped at zero) captured when the scale last settled.
+ * Returns 1 if a latched value is available, 0 otherwise.
+ */
+uint8 hx711_getStableWeightGrams(sint32 *grams)
+{
+    sint32 value;
+
+    if((grams == NULL) || !g_stableLatched)
+    {
+        return 0U;
+    }
+
+    value = hx711_rawtograms(g_stableLatchedRaw);
+    *grams = (value < 0) ? 0 : value;
+
+    return 1U;
+}
+
+/*
+ * Drop the latched stable weight (e.g. after it has been consumed).
+ */
+void hx711_clearStableLatch(void)
+{
+    g_stableLatched = 0;
+}
+
+/*---------------------------------------------------------------------------------
+ * SETTLING PREDICTION
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Predicted final weight (grams, clamped at zero) while the platter is
+ * still settling, or the filtered weight once stable.
+ * Returns 1 if the prediction is trustworthy, 0 otherwise.
+ */
+uint8 hx711_getPredictedWeightGrams(sint32 *grams)
+{
+    sint32 value;
+
+    (void)hx711_update();
+
+    if((grams == NULL) || !g_filterPrimed)
+    {
+        return 0U;
+    }
+
+    value  = hx711_rawtograms(g_predRaw);
+    *grams = (value < 0) ? 0 : value;
+
+    return g_predConfident;
+}
+
+/*---------------------------------------------------------------------------------
+ * AUTOMATIC ZERO TRACKING
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Enable automatic zero tracking.
+ */
+void hx711_enableZeroTracking(void)
+{
+    g_zeroTrackEnabled = 1;
+}
+
+/*
+ * Disable automatic zero tracking; the offset keeps its current value.
+ */
+void hx711_disableZeroTracking(void)
+{
+    g_zeroTrackEnabled = 0;
+}
+
+/*
+ * Set the offset that bounds zero tracking (normally the stored
+ * calibration offset; hx711_init() uses its offset argument).
+ */
+void hx711_setZeroTrackingReference(sint32 reference)
+{
+    g_zeroReference = reference;
+}
+
+/*
+ * Accumulated zero-tracking correction in counts (offset - reference).
+ */
+sint32 hx711_getZeroTrackingCorrection(void)
+{
+    return g_offset - g_zeroReference;
+}
+
+/*
+ * Return calibrated weight in kilograms.
+ */
+double hx711_getweight(void)
+{
+    return (double)hx711_getweightgrams() * 0.001;
+}
+
+/*
+ * Return calibrated weight in grams from filter state (fixed-point path,
+ * clamped at zero).
+ */
+sint32 hx711_getweightgrams(void)
+{
+    sint32 grams = hx711_rawtograms(hx711_getFilteredRaw());
+
+    if(grams < 0)
+        grams = 0;
+
+    return grams;
+}
+
+/*
+ * Convert a raw reading to grams: one 32x32->64 multiply and a high-word
+ * extract, rounded to nearest.
+ */
+sint32 hx711_rawtograms(sint32 raw)
+{
+    if(g_calCount > 1U)
+    {
+        return calibration_lookup(raw - g_offset);
+    }
+
+    return hx711_countsToGrams(raw - g_offset, g_scaleRecip);
+}
+
+/*
+ * Calibration step 1: set tare offset to current average reading. The
+ * offset is kept if the HX711 stops answering (HX711_FAULT_NO_DATA).
+ */
+void hx711_calibrate1setoffset(void)
+{
+    sint32 average;
+
+    if(hx711_calibrationAverage(&average))
+    {
+        g_offset = average;
+    }
+}
+
+/*
+ * Calibration step 1 for auto-ranging: zero at gain 64 on the empty
+ * platform, paired with the offset just set. The gain 64 pair stays invalid
+ * until step 2. Calibration only - a tare must not run it.
+ */
+void hx711_calibrateLowGainZero(void)
+{
+#if HX711_AUTORANGE_ENABLED
+    sint32 zero;
+
+    if((g_gainValue == HX711_GAINCHANNELA128 || g_autoRange) && !g_simulationEnabled &&
+       autorange_captureLowGain(&zero))
+    {
+        g_lowGainScale  = 0.0;
+        g_lowGainZero   = g_offset;
+        g_lowGainOffset = zero;
+        autorange_updateMapping();
+    }
+#endif
+}
+
+/*
+ * Calibration step 2: compute scale factor using known weight (kg). The
+ * scale is kept if the HX711 stops answering (HX711_FAULT_NO_DATA).
+ */
+void hx711_calibrate2setscale(double knownWeight)
+{
+    sint32 rawValue;
+
+    if((knownWeight <= 0.0) || !hx711_calibrationAverage(&rawValue))
+    {
+        return;
+    }
+
+    g_scale = (double)(rawValue - g_offset) / knownWeight;
+
+    if(g_scale == 0.0)
+    {
+        g_scale = 1.0;
+    }
+
+#if HX711_AUTORANGE_ENABLED
+    /* Same load at gain 64, against hx711_calibrateLowGainZero() */
+    if((g_gainValue == HX711_GAINCHANNELA128 || g_autoRange) && !g_simulationEnabled &&
+       (g_lowGainZero == g_offset) && autorange_captureLowGain(&rawValue))
+    {
+        g_lowGainScale = (double)(rawValue - g_lowGainOffset) / knownWeight;
+    }
+#endif
+
+    hx711_updateScaleDerived();
+}
+
+/*
+ * Drop the multi-point table and return to the single scale.
+ */
+void hx711_clearCalibrationPoints(void)
+{
+    g_calCount = 0;
+}
+
+/*
+ * Capture the current averaged reading as a calibration point for the
+ * given load. Tare first. Returns 1 when the point was accepted.
+ */
+uint8 hx711_addCalibrationPoint(sint32 grams)
+{
+    sint32 average;
+
+    if(!hx711_calibrationAverage(&average))
+    {
+        return 0U;
+    }
+
+    return calibration_insert(average - g_offset, grams);
+}
+
+/*
+ * Replace the table with stored points (e.g. restored from EEPROM), in any
+ * order. Returns 0 and leaves the single scale in use if a point is
+ * rejected.
+ */
+uint8 hx711_setCalibrationPoints(const sint32 *counts, const sint32 *grams, uint8 count)
+{
+    uint8 i;
+
+    g_calCount = 0;
+
+    if((counts == NULL) || (grams == NULL) || (count > HX711_CAL_MAX_POINTS))
+    {
+        return 0U;
+    }
+
+    for(i = 0; i < count; i++)
+    {
+        if(!calibration_insert(counts[i], grams[i]))
+        {
+            g_calCount = 0;
+            return 0U;
+        }
+    }
+
+    return 1U;
+}
+
+/*
+ * Copy out the captured points (tare point excluded, counts ascending).
+ * Arrays hold HX711_CAL_MAX_POINTS entries. Returns the number of points.
+ */
+uint8 hx711_getCalibrationPoints(sint32 *counts, sint32 *grams)
+{
+    uint8 n = 0;
+    uint8 i;
+
+    for(i = 0; i < g_calCount; i++)
+    {
+        if(g_calCounts[i] == 0)
+        {
+            continue;
+        }
+
+        if(counts != NULL)
+            counts[n] = g_calCounts[i];
+        if(grams != NULL)
+            grams[n] = g_calGrams[i];
+        n++;
+    }
+
+    return n;
+}
+
+/*
+ * Tare to zero. In HX711_TARE_INSTANT mode a stable scale is tared from
+ * the filter output without touching the ADC; otherwise (or in motion)
+ * this is calibrate1setoffset(). Returns 1 when the instant path was taken.
+ */
+uint8 hx711_taretozero(void)
+{
+    if(g_tareMode == HX711_TARE_INSTANT)
+    {
+        /* Bring filter and stability state up to date first */
+        (void)hx711_update();
+
+        if(g_filterPrimed && g_isStable)
+        {
+            g_offset = g_filteredRaw;
+            return 1U;
+        }
+    }
+
+    hx711_calibrate1setoffset();
+
+    return 0U;
+}
+
+/*
+ * Select how hx711_taretozero() obtains the new offset.
+ */
+void hx711_setTareMode(HX711_TareMode_t mode)
+{
+    g_tareMode = mode;
+}
+
+HX711_TareMode_t hx711_getTareMode(void)
+{
+    return g_tareMode;
+}
+
+/*
+ * Set scale factor.
+ */
+void hx711_setscale(double scale)
+{
+    if(scale != 0.0)
+    {
+        g_scale = scale;
+        hx711_updateScaleDerived();
+    }
+}
+
+/*
+ * Get scale factor.
+ */
+double hx711_getscale(void)
+{
+    return g_scale;
+}
+
+/*
+ * Set offset.
+ */
+void hx711_setoffset(sint32 offset)
+{
+    g_offset = offset;
+}
+
+/*
+ * Get offset.
+ */
+sint32 hx711_getoffset(void)
+{
+    return g_offset;
+}
+
+/*
+ * Set the fixed-point reciprocal directly (e.g. restored from EEPROM).
+ * Zero is rejected; the value derived from the scale is kept instead.
+ */
+void hx711_setscalerecip(sint32 scaleRecip)
+{
+    if(scaleRecip != 0)
+    {
+        g_scaleRecip = scaleRecip;
+    }
+}
+
+/*
+ * Get the fixed-point reciprocal (grams per count, Q32).
+ */
+sint32 hx711_getscalerecip(void)
+{
+    return g_scaleRecip;
+}
+
+/*
+ * Get gain (actual numeric gain value).
+ */
+uint8 hx711_getgain(void)
+{
+    return g_gainValue;
+}
+
+/*---------------------------------------------------------------------------------
+ * MULTI-LOAD-CELL PLATFORM
+ *--------------------------------------------------------------------------------*/
+#if HX711_MULTI_CELL_ENABLED
+
+/*
+ * Configure every cell's DOUT as an input with pull-up. Offsets start at
+ * zero and every cell takes the hx711_init() scale until calibrated on its
+ * own. Call after hx711_init(), which sets up SCK and the gain.
+ */
+void hx711_multiInit(void)
+{
+    uint8 cell;
+
+    g_cellMask = 0;
+
+    for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+    {
+        CLEAR_BIT(HX711_MULTI_DOUT_DDR, g_cellPinNum[cell]);  /* DOUT as input  */
+        SET_BIT(HX711_MULTI_DOUT_PORT, g_cellPinNum[cell]);   /* pull-up enable */
+
+        g_cellMask |= (uint8)(1U << g_cellPinNum[cell]);
+        g_cellRaw[cell]    = 0;
+        g_cellOffset[cell] = 0;
+        g_cellRecip[cell]  = g_scaleRecip;
+    }
+}
+
+/*
+ * All cells have a conversion ready (every DOUT low).
+ */
+uint8 hx711_multiIsReady(void)
+{
+    return ((HX711_MULTI_DOUT_PIN & g_cellMask) == 0U) ? 1U : 0U;
+}
+
+/*
+ * Wait for every cell and read them in one pass. raw (optional) receives
+ * HX711_MULTI_CELL_COUNT samples. Returns 0 while the single-cell ISR owns
+ * the bus or in simulation.
+ */
+uint8 hx711_multiRead(sint32 *raw)
+{
+    if(g_simulationEnabled || hx711_isAcquisitionActive())
+    {
+        return 0U;
+    }
+
+    while(!hx711_multiIsReady())
+    {
+        _delay_us(10);
+    }
+
+    return hx711_multiTryRead(raw);
+}
+
+/*
+ * Non-blocking variant: returns 0 immediately unless every cell is ready.
+ */
+uint8 hx711_multiTryRead(sint32 *raw)
+{
+    uint8 cell;
+
+    if(g_simulationEnabled || hx711_isAcquisitionActive() || !hx711_multiIsReady())
+    {
+        return 0U;
+    }
+
+    multi_shiftInAll(g_cellRaw);
+
+    if(raw != NULL)
+    {
+        for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+        {
+            raw[cell] = g_cellRaw[cell];
+        }
+    }
+
+    return 1U;
+}
+
+/*
+ * Set every cell's offset to its average over the given number of passes.
+ */
+void hx711_multiTare(uint8 times)
+{
+    sint32 sum[HX711_MULTI_CELL_COUNT];
+    uint8  cell;
+    uint8  i;
+
+    if(times == 0U)
+    {
+        times = 1;
+    }
+
+    for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+    {
+        sum[cell] = 0;
+    }
+
+    for(i = 0; i < times; i++)
+    {
+        if(!hx711_multiRead(NULL))
+        {
+            return;
+        }
+
+        for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+        {
+            sum[cell] += g_cellRaw[cell];
+        }
+    }
+
+    for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+    {
+        g_cellOffset[cell] = hx711_averageSum(sum[cell], times);
+    }
+}
+
+/*
+ * Per-cell offset.
+ */
+void hx711_multiSetCellOffset(uint8 cell, sint32 offset)
+{
+    if(cell < HX711_MULTI_CELL_COUNT)
+    {
+        g_cellOffset[cell] = offset;
+    }
+}
+
+sint32 hx711_multiGetCellOffset(uint8 cell)
+{
+    return (cell < HX711_MULTI_CELL_COUNT) ? g_cellOffset[cell] : 0;
+}
+
+/*
+ * Per-cell scale (counts per kg), stored as its Q32 reciprocal.
+ */
+void hx711_multiSetCellScale(uint8 cell, double scale)
+{
+    if((cell < HX711_MULTI_CELL_COUNT) && (scale != 0.0))
+    {
+        g_cellRecip[cell] = hx711_scaleToRecip(scale);
+    }
+}
+
+/*
+ * Per-cell Q32 reciprocal (e.g. restored from EEPROM). Zero is rejected.
+ */
+void hx711_multiSetCellScaleRecip(uint8 cell, sint32 scaleRecip)
+{
+    if((cell < HX711_MULTI_CELL_COUNT) && (scaleRecip != 0))
+    {
+        g_cellRecip[cell] = scaleRecip;
+    }
+}
+
+sint32 hx711_multiGetCellScaleRecip(uint8 cell)
+{
+    return (cell < HX711_MULTI_CELL_COUNT) ? g_cellRecip[cell] : 0;
+}
+
+/*
+ * Weight on one cell in grams, from the latest pass.
+ */
+sint32 hx711_multiGetCellGrams(uint8 cell)
+{
+    if(cell >= HX711_MULTI_CELL_COUNT)
+    {
+        return 0;
+    }
+
+    return hx711_countsToGrams(g_cellRaw[cell] - g_cellOffset[cell], g_cellRecip[cell]);
+}
+
+/*
+ * Platform weight in grams: sum of all cells from the latest pass.
+ */
+sint32 hx711_multiGetPlatformGrams(void)
+{
+    sint32 total = 0;
+    uint8  cell;
+
+    for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+    {
+        total += hx711_multiGetCellGrams(cell);
+    }
+
+    return total;
+}
+
+/*
+ * Corner-load diagnostic from the latest pass. Returns 0 (result untouched)
+ * while the platform carries less than HX711_MULTI_CORNER_MIN_GRAMS, where
+ * the shares are dominated by noise.
+ */
+uint8 hx711_multiGetCornerLoad(HX711_CornerLoad_t *result)
+{
+    sint32 cellGrams[HX711_MULTI_CELL_COUNT];
+    sint32 total = 0;
+    sint32 even  = 1000L / HX711_MULTI_CELL_COUNT;
+    uint8  cell;
+
+    if(result == NULL)
+    {
+        return 0U;
+    }
+
+    for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+    {
+        cellGrams[cell] = hx711_multiGetCellGrams(cell);
+        if(cellGrams[cell] < 0)
+        {
+            cellGrams[cell] = 0;
+        }
+        total += cellGrams[cell];
+    }
+
+    if(total < HX711_MULTI_CORNER_MIN_GRAMS)
+    {
+        return 0U;
+    }
+
+    result->heaviestCell = 0;
+    result->maxDeviation = 0;
+    result->overloadMask = 0;
+
+    for(cell = 0; cell < HX711_MULTI_CELL_COUNT; cell++)
+    {
+        sint32 share     = (sint32)(((sint64)cellGrams[cell] * 1000L) / total);
+        sint32 deviation = (share > even) ? (share - even) : (even - share);
+
+        result->shares[cell] = (uint16)share;
+
+        if(cellGrams[cell] > cellGrams[result->heaviestCell])
+        {
+            result->heaviestCell = cell;
+        }
+
+        if(deviation > (sint32)result->maxDeviation)
+        {
+            result->maxDeviation = (uint16)deviation;
+        }
+
+        if(cellGrams[cell] > HX711_MULTI_CELL_CAPACITY_GRAMS)
+        {
+            result->overloadMask |= (uint8)(1U << cell);
+        }
+    }
+
+    result->imbalanced = (result->maxDeviation > HX711_MULTI_CORNER_IMBALANCE_PERMILLE) ? 1U : 0U;
+
+    return 1U;
+}
+
+#endif /* HX711_MULTI_CELL_ENABLED */
+
+/*
+ * Power down HX711.
+ */
+void hx711_powerdown(void)
+{
+    HX711_SCK_LOW();
+    _delay_us(2);
+    HX711_SCK_HIGH();
+    g_poweredDown = 1;
+    _delay_us(70);
+}
+
+/*
+ * Power up HX711. The chip restarts on channel A / gain 128 and its output
+ * needs a few conversions to settle; those are dropped before any sample
+ * is delivered again.
+ */
+void hx711_powerup(void)
+{
+    uint8 sreg = SREG;
+
+    cli();
+
+#if HX711_AUTO_POWERDOWN_ENABLED
+    g_warmupDiscard = HX711_WARMUP_DISCARD_SAMPLES;
+    g_idleSamples   = 0;
+#endif
+#if HX711_INTERLEAVE_ENABLED
+    g_convChannel        = HX711_CHANNEL_A;
+    g_interleaveRun      = 0;
+    g_interleaveSettling = 0;
+#endif
+#if HX711_AUTORANGE_ENABLED
+    g_convPulses    = HX711_PULSES_A128;  /* power-up resets the gain */
+    g_rangeSwitched = 0;
+#endif
+    g_poweredDown  = 0;
+    g_timingResync = 1;
+
+    HX711_SCK_LOW();
+
+    SREG = sreg;
+
+    _delay_us(2);
+}
+
+/*
+ * Power down automatically after the given number of seconds without a
+ * consumer read or hx711_wake(). 0 disables the timeout.
+ */
+void hx711_setIdlePowerDown(uint16 seconds)
+{
+#if HX711_AUTO_POWERDOWN_ENABLED
+    uint32 samples = (uint32)seconds * HX711_SAMPLE_RATE_SPS;
+    uint8  sreg    = SREG;
+
+    cli();
+    g_idleLimit   = (samples > 0xFFFFUL) ? 0xFFFFU : (uint16)samples;
+    g_idleSamples = 0;
+    SREG = sreg;
+#else
+    (void)seconds;
+#endif
+}
+
+/*
+ * Note activity: restart the idle timeout and, if the HX711 is powered
+ * down, power it up, drop the stale filter state and start warming.
+ */
+void hx711_wake(void)
+{
+#if HX711_AUTO_POWERDOWN_ENABLED
+    uint8 sreg = SREG;
+
+    cli();
+    g_idleSamples = 0;
+    SREG = sreg;
+#endif
+
+    if(g_poweredDown)
+    {
+        hx711_powerup();
+        hx711_resetFilter();
+    }
+    else
+    {
+        hx711_releaseSck();
+    }
+}
+
+/*
+ * SCK must idle low. If something else left it high (another driver on the
+ * port, a glitch) the chip has powered down without g_poweredDown being
+ * set and restarts like a power-up once SCK drops.
+ */
+static void hx711_releaseSck(void)
+{
+    if(!g_poweredDown && BIT_IS_SET(HX711_SCK_PORT, HX711_SCK_PINNUM))
+    {
+        hx711_powerup();
+        hx711_resetFilter();
+    }
+}
+
+/*
+ * Return 1 while the HX711 is powered down (manually or by the timeout).
+ */
+uint8 hx711_isPoweredDown(void)
+{
+    return g_poweredDown;
+}
+
+/*
+ * Time one hardware readout with Timer1 at F_CPU. Waits for data-ready
+ * outside the measurement. Not available while the ISR owns the bus or in
+ * simulation.
+ */
+uint8 hx711_benchmarkRead(HX711_Benchmark_t *result)
+{
+#if HX711_BENCHMARK_ENABLED
+    uint8  savedTccr1a;
+    uint8  savedTccr1b;
+    uint16 start;
+    uint16 stop;
+
+    if((result == NULL) || g_simulationEnabled || hx711_isAcquisitionActive())
+    {
+        return 0U;
+    }
+
+    savedTccr1a = TCCR1A;
+    savedTccr1b = TCCR1B;
+    TCCR1A = 0;
+    TCCR1B = (1U << CS10);   /* normal mode, no prescaler */
+
+    while(!hx711_isready())
+    {
+    }
+
+    g_benchIrqOffMax = 0;
+    g_benchHold      = 1;
+
+    start = TCNT1;
+    HX711_READ_CRITICAL_BEGIN();
+    (void)hx711_shiftInSample();
+    HX711_READ_CRITICAL_END();
+    stop = TCNT1;
+
+    g_benchHold = 0;
+
+    TCCR1B = savedTccr1b;
+    TCCR1A = savedTccr1a;
+    g_timingResync = 1;
+
+    result->readCycles   = (uint16)(stop - start);
+    result->irqOffCycles = g_benchIrqOffMax;
+
+    return 1U;
+#else
+    (void)result;
+    return 0U;
+#endif
+}
+
+/*
+ * Time the byte-wise readout and the single-loop one on two consecutive
+ * conversions with Timer1 at F_CPU. Waits for data-ready outside the
+ * measurement. Not available while the ISR owns the bus or in simulation.
+ */
+uint8 hx711_benchmarkShiftIn(HX711_ShiftInBenchmark_t *result)
+{
+#if HX711_BENCHMARK_ENABLED
+    uint8  savedTccr1a;
+    uint8  savedTccr1b;
+    uint16 start;
+    uint16 stop;
+
+    if((result == NULL) || g_simulationEnabled || hx711_isAcquisitionActive())
+    {
+        return 0U;
+    }
+
+    savedTccr1a = TCCR1A;
+    savedTccr1b = TCCR1B;
+    TCCR1A = 0;
+    TCCR1B = (1U << CS10);   /* normal mode, no prescaler */
+
+    while(!hx711_isready())
+    {
+    }
+
+    g_benchHold = 1;
+
+    start = TCNT1;
+    HX711_READ_CRITICAL_BEGIN();
+    (void)hx711_shiftInBytes();
+    HX711_READ_CRITICAL_END();
+    stop = TCNT1;
+    result->bytesCycles = (uint16)(stop - start);
+
+    while(!hx711_isready())
+    {
+    }
+
+    start = TCNT1;
+    HX711_READ_CRITICAL_BEGIN();
+    (void)hx711_shiftInSample();
+    HX711_READ_CRITICAL_END();
+    stop = TCNT1;
+    result->loopCycles = (uint16)(stop - start);
+
+    g_benchHold = 0;
+
+    TCCR1B = savedTccr1b;
+    TCCR1A = savedTccr1a;
+    g_timingResync = 1;
+
+    result->bytesUs = (uint16)(result->bytesCycles / (F_CPU / 1000000UL));
+    result->loopUs  = (uint16)(result->loopCycles / (F_CPU / 1000000UL));
+
+    return 1U;
+#else
+    (void)result;
+    return 0U;
+#endif
+}
+
+/*
+ * Compare the legacy double conversion with the fixed-point one on the same
+ * raw sample, timed with Timer1 at F_CPU.
+ */
+uint8 hx711_benchmarkWeight(sint32 raw, HX711_WeightBenchmark_t *result)
+{
+#if HX711_BENCHMARK_ENABLED
+    volatile double sinkDouble;
+    volatile sint32 sinkFixed;
+    uint8  savedTccr1a;
+    uint8  savedTccr1b;
+    uint16 start;
+
+    if(result == NULL)
+    {
+        return 0U;
+    }
+
+    savedTccr1a = TCCR1A;
+    savedTccr1b = TCCR1B;
+    TCCR1A = 0;
+    TCCR1B = (1U << CS10);
+
+    start = TCNT1;
+    sinkDouble = (double)(raw - g_offset) / g_scale;
+    result->doubleCycles = (uint16)(TCNT1 - start);
+
+    start = TCNT1;
+    sinkFixed = hx711_rawtograms(raw);
+    result->fixedCycles = (uint16)(TCNT1 - start);
+
+    TCCR1B = savedTccr1b;
+    TCCR1A = savedTccr1a;
+    g_timingResync = 1;
+
+    (void)sinkDouble;
+    (void)sinkFixed;
+
+    return 1U;
+#else
+    (void)raw;
+    (void)result;
+    return 0U;
+#endif
+}
+
+/*
+ * Run a recorded trace through a private comb (the live stage is not
+ * touched) and compare peak-to-peak ripple before and after, skipping the
+ * fill. The trace should hold a constant load. Cycles are counted with
+ * Timer1 at F_CPU.
+ */
+uint8 hx711_benchmarkNotch(const sint32 *trace, uint16 length, HX711_NotchBenchmark_t *result)
+{
+#if HX711_BENCHMARK_ENABLED
+    HX711_Notch_t notch;
+    sint32 inMin;
+    sint32 inMax;
+    sint32 outMin;
+    sint32 outMax;
+    uint32 cycles = 0;
+    uint8  savedTccr1a;
+    uint8  savedTccr1b;
+    uint16 i;
+
+    if((trace == NULL) || (result == NULL) || (length <= HX711_NOTCH_LENGTH))
+    {
+        return 0U;
+    }
+
+    notch.primed = 0;
+
+    savedTccr1a = TCCR1A;
+    savedTccr1b = TCCR1B;
+    TCCR1A = 0;
+    TCCR1B = (1U << CS10);
+
+    inMin  = inMax  = trace[HX711_NOTCH_LENGTH];
+    outMin = outMax = 0;
+
+    for(i = 0; i < length; i++)
+    {
+        uint16 start = TCNT1;
+        sint32 out   = notch_apply(&notch, trace[i]);
+
+        cycles += (uint16)(TCNT1 - start);
+
+        if(i < HX711_NOTCH_LENGTH)
+        {
+            continue;
+        }
+
+        if(i == HX711_NOTCH_LENGTH)
+        {
+            outMin = outMax = out;
+        }
+
+        if(trace[i] < inMin)  inMin  = trace[i];
+        if(trace[i] > inMax)  inMax  = trace[i];
+        if(out < outMin)      outMin = out;
+        if(out > outMax)      outMax = out;
+    }
+
+    TCCR1B = savedTccr1b;
+    TCCR1A = savedTccr1a;
+    g_timingResync = 1;
+
+    result->inputRipple     = inMax - inMin;
+    result->outputRipple    = outMax - outMin;
+    result->cyclesPerSample = (uint16)(cycles / length);
+
+    return 1U;
+#else
+    (void)trace;
+    (void)length;
+    (void)result;
+    return 0U;
+#endif
+}
+
+/*---------------------------------------------------------------------------------
+ * SAMPLE TIMING
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Run Timer1 free-running as the sample timebase and start collecting
+ * cadence statistics. Timer1 is owned by the driver from here on (the
+ * benchmarks still borrow it briefly).
+ */
+void hx711_startSampleStats(void)
+{
+#if HX711_TIMING_ENABLED
+    TCCR1A = 0;
+    TCCR1B = HX711_TIMER1_CS_BITS;      /* normal mode */
+
+    hx711_resetSampleStats();
+
+    g_timingActive = 1;
+#endif
+}
+
+/*
+ * Clear min / max / mean, the missed and the overrun counters.
+ */
+void hx711_resetSampleStats(void)
+{
+#if HX711_TIMING_ENABLED
+    uint8 sreg = SREG;
+
+    cli();
+
+    g_intervalMin   = 0xFFFFU;
+    g_intervalMax   = 0;
+    g_intervalSum   = 0;
+    g_intervalCount = 0;
+    g_missedSamples = 0;
+    g_timingResync  = 1;
+#if HX711_ISR_ACQUISITION_ENABLED
+    g_sampleOverruns = 0;
+#endif
+
+    SREG = sreg;
+#endif
+}
+
+/*
+ * Snapshot of the cadence statistics; all zero before two conversions.
+ */
+void hx711_getSampleStats(HX711_SampleStats_t *stats)
+{
+#if HX711_TIMING_ENABLED
+    uint8  sreg;
+    uint16 minTicks;
+    uint16 maxTicks;
+    uint32 sum;
+    uint16 count;
+#endif
+
+    if(stats == NULL)
+    {
+        return;
+    }
+
+    stats->minIntervalUs  = 0;
+    stats->maxIntervalUs  = 0;
+    stats->meanIntervalUs = 0;
+    stats->intervals      = 0;
+    stats->missed         = 0;
+    stats->overruns       = hx711_getOverrunCount();
+
+#if HX711_TIMING_ENABLED
+    sreg = SREG;
+    cli();
+    minTicks       = g_intervalMin;
+    maxTicks       = g_intervalMax;
+    sum            = g_intervalSum;
+    count          = g_intervalCount;
+    stats->missed  = g_missedSamples;
+    SREG = sreg;
+
+    if(count > 0U)
+    {
+        stats->minIntervalUs  = (uint32)minTicks * HX711_TIMER1_US_PER_TICK;
+        stats->maxIntervalUs  = (uint32)maxTicks * HX711_TIMER1_US_PER_TICK;
+        stats->meanIntervalUs = (sum / count) * HX711_TIMER1_US_PER_TICK;
+        stats->intervals      = count;
+    }
+#endif
+}
+
+/*
+ * hx711_tryGetSample() that also returns the Timer1 stamp of the
+ * conversion (0 without timing or in simulation).
+ */
+uint8 hx711_tryGetTimedSample(sint32 *sample, uint16 *stamp)
+{
+#if HX711_TIMING_ENABLED && HX711_ISR_ACQUISITION_ENABLED
+    uint8 tail = g_sampleTail;
+    uint8 queued = (uint8)(g_acquisitionActive && !g_simulationEnabled);
+#endif
+
+    if(!hx711_tryGetSample(sample))
+    {
+        return 0U;
+    }
+
+    if(stamp != NULL)
+    {
+#if HX711_TIMING_ENABLED
+#if HX711_ISR_ACQUISITION_ENABLED
+        /* The slot is not reused until the tail has moved past it */
+        *stamp = queued ? g_sampleStamp[tail] : g_lastStamp;
+#else
+        *stamp = g_lastStamp;
+#endif
+#else
+        *stamp = 0;
+#endif
+    }
+
+    return 1U;
+}
+
+/*---------------------------------------------------------------------------------
+ * GAIN AUTO-RANGING
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Start switching channel A between gain 128 and 64 on the raw level.
+ * Returns 0 when hx711_init() did not set up channel A / 128 or
+ * auto-ranging is compiled out.
+ */
+uint8 hx711_enableAutoRange(void)
+{
+#if HX711_AUTORANGE_ENABLED
+    if(g_autoRange)
+    {
+        return 1U;
+    }
+
+    if((g_gainValue != HX711_GAINCHANNELA128) || (g_gain != HX711_PULSES_A128))
+    {
+        return 0U;
+    }
+
+    g_autoRange = 1;
+
+    return 1U;
+#else
+    return 0U;
+#endif
+}
+
+/*
+ * Back to fixed gain 128. Conversions still in flight at gain 64 are
+ * dropped.
+ */
+void hx711_disableAutoRange(void)
+{
+#if HX711_AUTORANGE_ENABLED
+    uint8 sreg = SREG;
+
+    cli();
+
+    if(g_autoRange)
+    {
+        g_autoRange = 0;
+        g_gain      = HX711_PULSES_A128;
+        g_gainValue = HX711_GAINCHANNELA128;
+    }
+
+    SREG = sreg;
+#endif
+}
+
+uint8 hx711_isAutoRangeEnabled(void)
+{
+#if HX711_AUTORANGE_ENABLED
+    return g_autoRange;
+#else
+    return 0U;
+#endif
+}
+
+/*
+ * Restore the gain 64 calibration (e.g. from EEPROM): counts per kg and the
+ * empty-platform reading at gain 64. It pairs with the current offset, so
+ * call it right after hx711_init() with the offset saved in the same
+ * calibration. A scale of 0 drops it (nominal ratio about the zeros).
+ */
+void hx711_setLowGainCalibration(double scale, sint32 offset)
+{
+#if HX711_AUTORANGE_ENABLED
+    g_lowGainScale  = scale;
+    g_lowGainOffset = (scale != 0.0) ? offset : 0;
+    g_lowGainZero   = (scale != 0.0) ? g_offset : 0;
+
+    autorange_updateMapping();
+#else
+    (void)scale;
+    (void)offset;
+#endif
+}
+
+/*
+ * Gain 64 calibration measured by the calibration steps. Returns 0 (outputs
+ * untouched) when there is none.
+ */
+uint8 hx711_getLowGainCalibration(double *scale, sint32 *offset)
+{
+#if HX711_AUTORANGE_ENABLED
+    if((scale == NULL) || (offset == NULL) || (g_lowGainScale == 0.0))
+    {
+        return 0U;
+    }
+
+    *scale  = g_lowGainScale;
+    *offset = g_lowGainOffset;
+
+    return 1U;
+#else
+    (void)scale;
+    (void)offset;
+    return 0U;
+#endif
+}
+
+/*---------------------------------------------------------------------------------
+ * SAMPLE RECORDER
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Start recording delivered samples into an empty ring and set USART0 up
+ * for dumps (8N1, double speed). TX stays disabled until a dump.
+ */
+void hx711_enableRecorder(void)
+{
+#if HX711_RECORDER_ENABLED
+    uint8 sreg = SREG;
+
+    cli();
+
+    g_recHead     = 0;
+    g_recTail     = 0;
+    g_recUsed     = 0;
+    g_recLastTick = g_recTick;
+    g_recEnabled  = 1;
+
+    SREG = sreg;
+
+    UBRR0  = (uint16)(((F_CPU + 4UL * HX711_RECORDER_BAUD) / (8UL * HX711_RECORDER_BAUD)) - 1UL);
+    UCSR0A = (1U << U2X0);
+    UCSR0C = (1U << UCSZ01) | (1U << UCSZ00);
+#endif
+}
+
+/*
+ * Stop recording. A dump in progress still completes.
+ */
+void hx711_disableRecorder(void)
+{
+#if HX711_RECORDER_ENABLED
+    g_recEnabled = 0;
+#endif
+}
+
+/*
+ * Freeze the ring and start streaming it (layout in hx711.h). Returns at
+ * once; 0 if nothing is recorded or a dump is already running.
+ */
+uint8 hx711_recorderDump(void)
+{
+#if HX711_RECORDER_ENABLED
+    uint8  sreg;
+    uint32 firstTick;
+
+    sreg = SREG;
+    cli();
+
+    if(g_recDumping || (g_recUsed == 0U))
+    {
+        SREG = sreg;
+        return 0U;
+    }
+
+    g_recDumping = 1;
+
+    SREG = sreg;
+
+    /* Frozen from here on: the ISR no longer appends */
+    firstTick = g_recBaseTick + 1UL;
+
+    g_dumpHeader[0]  = 'H';
+    g_dumpHeader[1]  = 'X';
+    g_dumpHeader[2]  = (uint8)(g_recUsed >> 8);
+    g_dumpHeader[3]  = (uint8)g_recUsed;
+    g_dumpHeader[4]  = (uint8)(firstTick >> 24);
+    g_dumpHeader[5]  = (uint8)(firstTick >> 16);
+    g_dumpHeader[6]  = (uint8)(firstTick >> 8);
+    g_dumpHeader[7]  = (uint8)firstTick;
+    g_dumpHeader[8]  = (uint8)((uint32)g_recBaseRaw >> 24);
+    g_dumpHeader[9]  = (uint8)((uint32)g_recBaseRaw >> 16);
+    g_dumpHeader[10] = (uint8)((uint32)g_recBaseRaw >> 8);
+    g_dumpHeader[11] = (uint8)g_recBaseRaw;
+
+    g_dumpIndex  = 0;
+    g_dumpLength = (uint16)(HX711_RECORDER_HEADER + g_recUsed);
+
+    /* TXD0 takes PD1 over from the keypad until TX complete */
+    UCSR0A |= (1U << TXC0);
+    UCSR0B  = (1U << TXEN0) | (1U << UDRIE0);
+
+    return 1U;
+#else
+    return 0U;
+#endif
+}
+
+/*
+ * Return 1 while a dump is streaming (recording is paused meanwhile).
+ */
+uint8 hx711_isRecorderDumping(void)
+{
+#if HX711_RECORDER_ENABLED
+    return g_recDumping;
+#else
+    return 0U;
+#endif
+}
+
+/*---------------------------------------------------------------------------------
+ * SIMULATION CONTROL
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Globally enable simulation.
+ */
+void hx711_enableSimulation(void)
+{
+    g_simulationEnabled = 1;
+    g_simPatternActive  = 0;
+    g_simTicksMs        = 0;
+}
+
+/*
+ * Globally disable simulation.
+ */
+void hx711_disableSimulation(void)
+{
+    g_simulationEnabled = 0;
+    g_simPatternActive  = 0;
+    g_simTicksMs        = 0;
+}
+
+/*
+ * Explicitly restart the simulation pattern timeline.
+ * Call this when entering the weighing state.
+ */
+void hx711_startSimulationPattern(void)
+{
+    g_simSource         = HX711_SIM_SOURCE_PATTERN;
+    g_simPatternActive  = 0;
+    g_simTicksMs        = 0;
+    g_simulationEnabled = 1;
+}
+
+/*
+ * Stop the simulation pattern (optional).
+ * Call this when leaving the weighing state.
+ */
+void hx711_stopSimulationPattern(void)
+{
+    g_simPatternActive  = 0;
+    g_simTicksMs        = 0;
+    g_simulationEnabled = 0;
+}
+
+/*
+ * Replay a delta-encoded raw trace (see SIMULATION CONFIGURATION) in
+ * place of the pattern. The buffer is used in place and must stay valid.
+ */
+void hx711_simLoadTrace(const uint8 *data, uint16 length, uint8 loop)
+{
+    g_simTrace       = data;
+    g_simTraceLength = (data == NULL) ? 0U : length;
+    g_simTracePos    = 0;
+    g_simTraceRaw    = 0;
+    g_simTraceLoop   = loop;
+    g_simFinished    = 0;
+
+    g_simSource         = HX711_SIM_SOURCE_TRACE;
+    g_simTicksMs        = 0;
+    g_simulationEnabled = 1;
+}
+
+/*
+ * Host build only: load a text trace (one decimal raw sample per line,
+ * '#' starts a comment line) and replay it. Returns 1 on success, 0 if the
+ * file cannot be read, holds no samples or does not fit the buffer.
+ */
+uint8 hx711_simLoadTraceFile(const char *path, uint8 loop)
+{
+#if HX711_SIM_HOST_FILE
+    FILE  *file;
+    char   line[32];
+    sint32 sample;
+    sint32 previous = 0;
+    uint16 used     = 0;
+    uint8  written;
+
+    file = (path == NULL) ? NULL : fopen(path, "r");
+    if(file == NULL)
+    {
+        return 0U;
+    }
+
+    while(fgets(line, sizeof(line), file) != NULL)
+    {
+        if((line[0] == '#') || (line[0] == '\n') || (line[0] == '\r'))
+        {
+            continue;
+        }
+
+        sample  = (sint32)strtol(line, NULL, 10);
+        written = sim_encodeSample(sample, previous, (used == 0U) ? 1U : 0U, &g_simFileBuffer[used],
+                                   (uint16)(HX711_SIM_FILE_BUFFER_BYTES - used));
+
+        if(written == 0U)
+        {
+            fclose(file);
+            return 0U;
+        }
+
+        used    += written;
+        previous = sample;
+    }
+
+    fclose(file);
+
+    if(used == 0U)
+    {
+        return 0U;
+    }
+
+    hx711_simLoadTrace(g_simFileBuffer, used, loop);
+
+    return 1U;
+#else
+    (void)path;
+    (void)loop;
+    return 0U;
+#endif
+}
+
+/*
+ * Encode raw samples into the trace format. Returns the bytes written, or
+ * 0 if the output does not have room for all of them.
+ */
+uint16 hx711_simEncodeTrace(const sint32 *raw, uint16 count, uint8 *out, uint16 capacity)
+{
+    uint16 used = 0;
+    uint16 i;
+    uint8  written;
+
+    if((raw == NULL) || (out == NULL))
+    {
+        return 0U;
+    }
+
+    for(i = 0; i < count; i++)
+    {
+        written = sim_encodeSample(raw[i], (i > 0U) ? raw[i - 1U] : 0, (i == 0U) ? 1U : 0U,
+                                   &out[used], (uint16)(capacity - used));
+        if(written == 0U)
+        {
+            return 0U;
+        }
+        used += written;
+    }
+
+    return used;
+}
+
+/*
+ * Run a scripted scenario in place of the pattern, restarting simulated
+ * time and the noise sequence.
+ */
+void hx711_simRunScenario(const HX711_Scenario_t *scenario)
+{
+    if(scenario == NULL)
+    {
+        return;
+    }
+
+    g_simScenario = *scenario;
+    g_simRng      = 0x2545F491UL;
+    g_simFinished = 0;
+
+    g_simSource         = HX711_SIM_SOURCE_SCENARIO;
+    g_simTicksMs        = 0;
+    g_simulationEnabled = 1;
+}
+
+/*
+ * Return 1 once a non-looping trace has been replayed completely.
+ */
+uint8 hx711_simIsFinished(void)
+{
+    return g_simFinished;
+}
+
+/*
+ * Feed the next samples of the active simulation source through the
+ * filter chain from a clean state and measure how the output settles:
+ * the sample at which the stability detector last became stable (and
+ * stayed so to the end of the run), then the peak-to-peak of the filtered
+ * output from there on.
+ */
+void hx711_simBenchmark(uint16 samples, HX711_SimBenchmark_t *result)
+{
+    uint16 i;
+    sint32 minRaw = 0;
+    sint32 maxRaw = 0;
+
+    if((result == NULL) || !g_simulationEnabled)
+    {
+        return;
+    }
+
+    result->samplesToStable = 0xFFFFU;
+    result->settledNoiseMg  = 0;
+
+    hx711_resetFilter();
+
+    for(i = 0; (i < samples) && !g_simFinished; i++)
+    {
+        hx711_feedSample(hx711_read_simulated());
+
+        if(!g_isStable)
+        {
+            result->samplesToStable = 0xFFFFU;
+        }
+        else if(result->samplesToStable == 0xFFFFU)
+        {
+            result->samplesToStable = (uint16)(i + 1U);
+            minRaw = g_filteredRaw;
+            maxRaw = g_filteredRaw;
+        }
+        else if(g_filteredRaw < minRaw)
+        {
+            minRaw = g_filteredRaw;
+        }
+        else if(g_filteredRaw > maxRaw)
+        {
+            maxRaw = g_filteredRaw;
+        }
+    }
+
+    if(result->samplesToStable != 0xFFFFU)
+    {
+        result->settledNoiseMg = (uint32)hx711_countsQToMilligrams(maxRaw - minRaw, g_scaleRecip, 0U);
+    }
+
+    result->finalGrams = hx711_rawtograms(g_filteredRaw);
+}
+
+/*---------------------------------------------------------------------------------
+ * INTERRUPT SERVICE ROUTINES
+ *--------------------------------------------------------------------------------*/
+#if HX711_ISR_ACQUISITION_ENABLED
+/*
+ * DOUT pin-change: a falling edge means a new conversion is ready.
+ */
+ISR(HX711_DOUT_PCINT_vect)
+{
+    sint32 sample;
+    uint8  head;
+    uint8  next;
+
+    /* Ignore the rising edge and any change while acquisition is stopped */
+    if(!g_acquisitionActive || !hx711_isready())
+    {
+        return;
+    }
+
+    /* Always clock the sample out so the HX711 keeps converting */
+    sample = hx711_shiftInSample();
+
+    if(hx711_routeSample(&sample))
+    {
+        head = g_sampleHead;
+        next = (uint8)((head + 1U) & HX711_SAMPLE_BUFFER_MASK);
+
+        if(next == g_sampleTail)
+        {
+            /* Buffer full */
+            if(g_sampleOverruns < 0xFFU)
+            {
+                g_sampleOverruns++;
+            }
+        }
+        else
+        {
+            g_sampleBuffer[head] = sample;
+#if HX711_TIMING_ENABLED
+            g_sampleStamp[head]  = g_lastStamp;
+#endif
+            g_sampleHead         = next;
+        }
+    }
+
+    /* DOUT toggled while shifting - discard the edges that generated */
+    PCIFR = (1U << HX711_DOUT_PCIFR_BIT);
+}
+#endif
+
+#if HX711_RECORDER_ENABLED
+/*
+ * USART0 data register empty: feed the next dump byte, header first.
+ */
+ISR(USART_UDRE_vect)
+{
+    uint16 index = g_dumpIndex;
+
+    if(index < HX711_RECORDER_HEADER)
+    {
+        UDR0 = g_dumpHeader[index];
+    }
+    else
+    {
+        UDR0 = g_recRing[(uint8)((g_recTail + (index - HX711_RECORDER_HEADER)) & HX711_RECORDER_MASK)];
+    }
+
+    index++;
+    g_dumpIndex = index;
+
+    if(index >= g_dumpLength)
+    {
+        /* Last byte queued: wait for it to leave the shifter */
+        UCSR0B = (1U << TXEN0) | (1U << TXCIE0);
+    }
+}
+
+/*
+ * USART0 transmit complete: hand PD1 back to the keypad, resume recording.
+ */
+ISR(USART_TX_vect)
+{
+    UCSR0B       = 0;
+    g_recDumping = 0;
 }
-=======
-/******************************************************************************
- * HX711 library for AVR ATmega328P - Implementation
- * With optional Proteus / software simulation support
- * Optimized for ~1 MHz CPU clock
- *
- ******************************************************************************/
-
-#include "hx711.h"
-
-/*---------------------------------------------------------------------------------
- * STATIC VARIABLES
- *--------------------------------------------------------------------------------*/
-static uint8  g_gain       = 1;      /* pulses count: 1=128, 3=64, 2=32        */
-static sint32 g_offset     = 0;      /* tare offset                             */
-static double g_scale      = 1.0;    /* scale factor (counts per kg)           */
-static uint8  g_gainValue  = 128;    /* actual gain value for getgain()        */
-
-/* Simulation state - uses counter instead of millis() */
-static uint8  g_simulationEnabled = HX711_SIMULATION_ENABLED_DEFAULT;
-static uint8  g_simPatternActive  = 0;
-static uint32 g_simTicksMs        = 0;  /* incremented on each simulated read */
-
-/*---------------------------------------------------------------------------------
- * PRIVATE MACROS (REAL HARDWARE)
- *--------------------------------------------------------------------------------*/
-#define HX711_SCK_HIGH()  SET_BIT(HX711_SCK_PORT, HX711_SCK_PINNUM)
-#define HX711_SCK_LOW()   CLEAR_BIT(HX711_SCK_PORT, HX711_SCK_PINNUM)
-#define HX711_DOUT_READ() ((HX711_DOUT_PIN >> HX711_DOUT_PINNUM) & 0x01)
-
-#define HX711_PULSE_DELAY_US   2
-
-/*---------------------------------------------------------------------------------
- * PRIVATE FUNCTION PROTOTYPES
- *--------------------------------------------------------------------------------*/
-static uint8  shiftIn_MSB(void);
-static float32 hx711_read_simulated(void);
-static float32 sim_weight_to_raw(double kg);
-
-/*---------------------------------------------------------------------------------
- * PRIVATE FUNCTIONS
- *--------------------------------------------------------------------------------*/
-
-/*
- * Shift in 8 bits MSB-first from HX711 DOUT, clocked by SCK.
- */
-static uint8 shiftIn_MSB(void)
-{
-    uint8 value = 0;
-    uint8 i;
-
-    for(i = 0; i < 8; i++)
-    {
-        HX711_SCK_HIGH();
-        _delay_us(HX711_PULSE_DELAY_US);
-
-        value |= (HX711_DOUT_READ() << (7 - i));
-
-        HX711_SCK_LOW();
-        _delay_us(HX711_PULSE_DELAY_US);
-    }
-
-    return value;
-}
-
-/*
- * Convert desired weight in kg to a synthetic raw reading, using
- * current scale and offset so that hx711_getweight() returns ~kg.
- */
-static float32 sim_weight_to_raw(double kg)
-{
-    /* raw = offset + scale * kg */
-    double raw = (double)g_offset + (g_scale * kg);
-    if(raw > 2147483647.0)
-        raw = 2147483647.0;
-    else if(raw < -2147483648.0)
-        raw = -2147483648.0;
-
-    return raw;
-}
-
-static float32 hx711_read_simulated(void)
-{
-    double targetKg;
-    uint32 elapsed;
-
-    if(!g_simPatternActive)
-    {
-        g_simPatternActive = 1;
-        g_simTicksMs       = 0;
-    }
-
-    elapsed = g_simTicksMs;
-
-    if(elapsed < 2000U)
-    {
-        /* Phase 1: 1 kg with small noise ±0.005 kg */
-        double noise;
-        uint8 slot = (uint8)((elapsed / 100U) % 11U);  /* 0-10 pattern */
-
-        /* Create smooth noise pattern from -0.005 to +0.005 kg */
-        switch(slot)
-        {
-            case 0:  noise = -0.005; break;
-            case 1:  noise = -0.004; break;
-            case 2:  noise = -0.003; break;
-            case 3:  noise = -0.002; break;
-            case 4:  noise = -0.001; break;
-            case 5:  noise =  0.000; break;
-            case 6:  noise =  0.001; break;
-            case 7:  noise =  0.002; break;
-            case 8:  noise =  0.003; break;
-            case 9:  noise =  0.004; break;
-            case 10: noise =  0.005; break;
-            default: noise =  0.000; break;
-        }
-
-        targetKg = 1.0 + noise;
-    }
-    else if(elapsed < 5000U)
-    {
-    	/* Phase 1: 1 kg with small noise ±0.005 kg */
-    	        double noise;
-    	        uint8 slot = (uint8)((elapsed / 100U) % 11U);  /* 0-10 pattern */
-
-    	        /* Create smooth noise pattern from -0.005 to +0.005 kg */
-    	        switch(slot)
-    	        {
-    	            case 0:  noise = -0.005; break;
-    	            case 1:  noise = -0.004; break;
-    	            case 2:  noise = -0.003; break;
-    	            case 3:  noise = -0.002; break;
-    	            case 4:  noise = -0.001; break;
-    	            case 5:  noise =  0.000; break;
-    	            case 6:  noise =  0.001; break;
-    	            case 7:  noise =  0.002; break;
-    	            case 8:  noise =  0.003; break;
-    	            case 9:  noise =  0.004; break;
-    	            case 10: noise =  0.005; break;
-    	            default: noise =  0.000; break;
-    	        }
-
-        /* Phase 2: 2 kg */
-        targetKg = 2.0+noise;
-    }
-    else
-    {
-    	/* Phase 1: 1 kg with small noise ±0.005 kg */
-    	        double noise;
-    	        uint8 slot = (uint8)((elapsed / 100U) % 11U);  /* 0-10 pattern */
-
-    	        /* Create smooth noise pattern from -0.005 to +0.005 kg */
-    	        switch(slot)
-    	        {
-    	            case 0:  noise = -0.005; break;
-    	            case 1:  noise = -0.004; break;
-    	            case 2:  noise = -0.003; break;
-    	            case 3:  noise = -0.002; break;
-    	            case 4:  noise = -0.001; break;
-    	            case 5:  noise =  0.000; break;
-    	            case 6:  noise =  0.001; break;
-    	            case 7:  noise =  0.002; break;
-    	            case 8:  noise =  0.003; break;
-    	            case 9:  noise =  0.004; break;
-    	            case 10: noise =  0.005; break;
-    	            default: noise =  0.000; break;
-    	        }
-
-        /* Phase 3: back to stable 1 kg */
-        targetKg = 1.0+noise;
-    }
-
-    /* Advance simulation "time" by 100 ms per read */
-    g_simTicksMs += 100U;
-
-    return sim_weight_to_raw(targetKg);
-}
-
-/*---------------------------------------------------------------------------------
- * PUBLIC FUNCTION IMPLEMENTATIONS
- *--------------------------------------------------------------------------------*/
-
-/*
- * Initialize HX711 driver.
- * gain  : HX711_GAINCHANNELA128, HX711_GAINCHANNELA64, HX711_GAINCHANNELB32
- * scale : scale factor (counts per kg)
- * offset: tare offset (raw value at 0 kg)
- */
-void hx711_init(uint8 gain, double scale, sint32 offset)
-{
-    /* Store scale and offset */
-    g_scale  = (scale  == 0.0) ? 1.0 : scale;
-    g_offset = offset;
-
-    /* Set gain pulses and value */
-    switch(gain)
-    {
-        case HX711_GAINCHANNELA128:
-            g_gain      = 1;
-            g_gainValue = 128;
-            break;
-
-        case HX711_GAINCHANNELA64:
-            g_gain      = 3;
-            g_gainValue = 64;
-            break;
-
-        case HX711_GAINCHANNELB32:
-            g_gain      = 2;
-            g_gainValue = 32;
-            break;
-
-        default:
-            g_gain      = 1;
-            g_gainValue = 128;
-            break;
-    }
-
-    /* Configure pins */
-    SET_BIT(HX711_SCK_DDR, HX711_SCK_PINNUM);    /* SCK as output  */
-    HX711_SCK_LOW();
-
-    CLEAR_BIT(HX711_DOUT_DDR, HX711_DOUT_PINNUM);/* DOUT as input  */
-    SET_BIT(HX711_DOUT_PORT, HX711_DOUT_PINNUM); /* pull-up enable */
-
-    _delay_ms(200);
-
-    /* Reset simulation state */
-    g_simPatternActive = 0;
-    g_simTicksMs       = 0;
-}
-
-/*
- * Check if HX711 is ready (DOUT low).
- */
-uint8 hx711_isready(void)
-{
-    return (HX711_DOUT_READ() == 0) ? 1U : 0U;
-}
-
-/*
- * Read a single raw value from HX711 or from simulation.
- */
-float32 hx711_read(void)
-{
-    /* Simulation branch */
-    if(g_simulationEnabled)
-    {
-        return hx711_read_simulated();
-    }
-
-    /* Real hardware branch */
-    uint8  data[3] = {0, 0, 0};
-    uint8  filler  = 0x00;
-    uint32 value   = 0;
-    uint8  i;
-
-    /* Wait for ready */
-    while(!hx711_isready())
-    {
-        _delay_us(10);
-    }
-
-    /* Critical section */
-    cli();
-
-    /* Read 24 bits MSB-first */
-    data[2] = shiftIn_MSB();
-    data[1] = shiftIn_MSB();
-    data[0] = shiftIn_MSB();
-
-    /* Set gain for next reading (1–3 pulses) */
-    for(i = 0; i < g_gain; i++)
-    {
-        HX711_SCK_HIGH();
-        _delay_us(HX711_PULSE_DELAY_US);
-        HX711_SCK_LOW();
-        _delay_us(HX711_PULSE_DELAY_US);
-    }
-
-    /* End critical section */
-    sei();
-
-    /* Sign extension */
-    if(data[2] & 0x80)
-    {
-        filler = 0xFF;
-    }
-
-    /* Build 32-bit signed value */
-    value = ((uint32)filler << 24) |
-            ((uint32)data[2] << 16) |
-            ((uint32)data[1] << 8)  |
-            ((uint32)data[0]);
-
-    return (sint32)value;
-}
-
-/*
- * Average multiple raw HX711 readings.
- */
-float32 hx711_readaverage(uint8 times)
-{
-    float64 sum = 0;
-    uint8  i;
-
-    if(times == 0U)
-        times = 1U;
-
-    for(i = 0; i < times; i++)
-    {
-        sum += (float64)hx711_read();
-        _delay_ms(5);
-    }
-
-    return (float32)(sum / (sint64)times);
-}
-
-/*
- * Return calibrated weight in kilograms.
- */
-double hx711_getweight(void)
-{
-    float32 raw     = hx711_readaverage(1);
-    double weight  = 0.0;
-
-    if(g_scale != 0.0)
-    {
-        weight = (double)(raw - g_offset) / g_scale;
-    }
-
-    if(weight < 0.0)
-        weight = 0.0;
-
-    return weight;
-}
-
-/*
- * Calibration step 1: set tare offset to current average reading.
- */
-void hx711_calibrate1setoffset(void)
-{
-    g_offset = hx711_readaverage(10);
-}
-
-/*
- * Calibration step 2: compute scale factor using known weight (kg).
- */
-void hx711_calibrate2setscale(double knownWeight)
-{
-    if(knownWeight <= 0.0)
-    {
-        return;
-    }
-
-    sint32 rawValue = hx711_readaverage(10);
-    g_scale = (double)(rawValue - g_offset) / knownWeight;
-
-    if(g_scale == 0.0)
-    {
-        g_scale = 1.0;
-    }
-}
-
-/*
- * Tare to zero: wrapper around calibrate1setoffset().
- */
-void hx711_taretozero(void)
-{
-    hx711_calibrate1setoffset();
-}
-
-/*
- * Set scale factor.
- */
-void hx711_setscale(double scale)
-{
-    if(scale != 0.0)
-    {
-        g_scale = scale;
-    }
-}
-
-/*
- * Get scale factor.
- */
-double hx711_getscale(void)
-{
-    return g_scale;
-}
-
-/*
- * Set offset.
- */
-void hx711_setoffset(sint32 offset)
-{
-    g_offset = offset;
-}
-
-/*
- * Get offset.
- */
-sint32 hx711_getoffset(void)
-{
-    return g_offset;
-}
-
-/*
- * Get gain (actual numeric gain value).
- */
-uint8 hx711_getgain(void)
-{
-    return g_gainValue;
-}
-
-/*
- * Power down HX711.
- */
-void hx711_powerdown(void)
-{
-    HX711_SCK_LOW();
-    _delay_us(2);
-    HX711_SCK_HIGH();
-    _delay_us(70);
-}
-
-/*
- * Power up HX711.
- */
-void hx711_powerup(void)
-{
-    HX711_SCK_LOW();
-    _delay_us(2);
-}
-
-/*---------------------------------------------------------------------------------
- * SIMULATION CONTROL
- *--------------------------------------------------------------------------------*/
-
-/*
- * Globally enable simulation.
- */
-void hx711_enableSimulation(void)
-{
-    g_simulationEnabled = 1;
-    g_simPatternActive  = 0;
-    g_simTicksMs        = 0;
-}
-
-/*
- * Globally disable simulation.
- */
-void hx711_disableSimulation(void)
-{
-    g_simulationEnabled = 0;
-    g_simPatternActive  = 0;
-    g_simTicksMs        = 0;
-}
-
-/*
- * Explicitly restart the simulation pattern timeline.
- * Call this when entering the weighing state.
- */
-void hx711_startSimulationPattern(void)
-{
-    g_simPatternActive  = 0;
-    g_simTicksMs        = 0;
-    g_simulationEnabled = 1;
-}
-
-/*
- * Stop the simulation pattern (optional).
- * Call this when leaving the weighing state.
- */
-void hx711_stopSimulationPattern(void)
-{
-    g_simPatternActive  = 0;
-    g_simTicksMs        = 0;
-    g_simulationEnabled = 0;
-}
->>>>>>> edc6387c1d585a5baaf460e549f88eece77f0548
+#endif
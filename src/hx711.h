@@ -1,12 +1,13 @@
-<<<<<<< HEAD
 /******************************************************************************
- *
  * HX711 library for AVR ATmega328P
- * With Proteus simulation support
- * Converted from Arduino C++ library to pure C
- * Original: https://github.com/bogde/HX711
+ * With optional Proteus / software simulation support
+ * Converted and extended for Fruit Weighing System project
+ *
+ * Original Arduino C++ library:
+ *   https://github.com/bogde/HX711
+ *
  * MIT License - (c) 2018 Bogdan Necula
- * Converted by: Ahmed Abdelaal - 2025
+ * C conversion & extensions: Ahmed Abdelaal - 2025
  *
  ******************************************************************************/
 
@@ -15,34 +16,351 @@
 
 /*---------------------------------------------------------------------------------
  * INCLUDES
- *---------------------------------------------------------------------------------*/
+ *--------------------------------------------------------------------------------*/
 #include "std_types.h"
 #include "micro_config.h"
 #include "common_macros.h"
 
 /*---------------------------------------------------------------------------------
- * SIMULATION MODE CONFIGURATION
- *---------------------------------------------------------------------------------*/
+ * TRANSPORT SELECTION
+ *--------------------------------------------------------------------------------*/
+/*
+ * BITBANG : 24 data bits toggled in software on any SCK pin, interrupts off
+ *           for the whole transfer.
+ * SPI     : the SPI block (mode 1, F_CPU/2) clocks the 3 data bytes; SCK idles
+ *           low between bytes so only the gain pulses run with interrupts off.
+ *           Requires SCK wired to PB5/SCK (Arduino D13); DOUT already sits on
+ *           PB4/MISO. PB2/SS is driven as an output to keep master mode.
+ *
+ * USART0 in MSPIM mode is not offered: XCK0 (PD4) drives LCD D4 and
+ * TXD0/RXD0 (PD1/PD0) are keypad columns on this board.
+ */
+#define HX711_TRANSPORT_BITBANG   0
+#define HX711_TRANSPORT_SPI       1
+
+#define HX711_TRANSPORT           HX711_TRANSPORT_BITBANG
+
+/*---------------------------------------------------------------------------------
+ * PIN CONFIGURATION (REAL HARDWARE)
+ *--------------------------------------------------------------------------------*/
+/* DOUT (data) on PB4 (Arduino D12) */
+#define HX711_DOUT_PORT      PORTB
+#define HX711_DOUT_DDR       DDRB
+#define HX711_DOUT_PIN       PINB
+#define HX711_DOUT_PINNUM    PB4
+
+#if (HX711_TRANSPORT == HX711_TRANSPORT_SPI)
+/* SCK (clock) on PB5/SCK (Arduino D13) */
+#define HX711_SCK_PORT       PORTB
+#define HX711_SCK_DDR        DDRB
+#define HX711_SCK_PIN        PINB
+#define HX711_SCK_PINNUM     PB5
+
+/* SS must not float low in master mode */
+#define HX711_SPI_SS_DDR     DDRB
+#define HX711_SPI_SS_PINNUM  PB2
+#else
+/* SCK (clock) on PC5 (Arduino A5) */
+#define HX711_SCK_PORT       PORTC
+#define HX711_SCK_DDR        DDRC
+#define HX711_SCK_PIN        PINC
+#define HX711_SCK_PINNUM     PC5
+#endif
+
+/*---------------------------------------------------------------------------------
+ * FIXED-POINT WEIGHT CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * The hot path converts raw counts to grams without soft-float:
+ *
+ *   grams = ((raw - offset) * scaleRecip) >> HX711_SCALE_RECIP_FRAC_BITS
+ *   scaleRecip = 1000 * 2^HX711_SCALE_RECIP_FRAC_BITS / scale
+ *
+ * With 32 fractional bits the shift is just the high word of the 64-bit
+ * product. scaleRecip saturates for scales below ~2000 counts/kg, far under
+ * any real load cell at gain 64/128.
+ */
+#define HX711_SCALE_RECIP_FRAC_BITS   32
+#define HX711_GRAMS_PER_KG            1000L
+
+/*---------------------------------------------------------------------------------
+ * PRECISION-TERMINATED AVERAGING CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Tare and calibration average until the standard error of the mean drops
+ * below a target instead of taking a fixed number of readings. Mean and
+ * variance are tracked with Welford's online update in integer arithmetic
+ * (mean in 1/16 count), and the stop test compares the sum of squared
+ * deviations with target^2 * n * (n - 1), so no square root runs per
+ * sample. At least HX711_PRECISE_MIN_SAMPLES are taken so
+ * the variance estimate means something; HX711_PRECISE_MAX_SAMPLES caps
+ * the time spent on a noisy signal (6.4 s at 10 SPS).
+ */
+#define HX711_PRECISE_TARGET_SEM_MG    100  /* standard error target, mg */
+#define HX711_PRECISE_MIN_SAMPLES      4
+#define HX711_PRECISE_MAX_SAMPLES      64
+
+/*---------------------------------------------------------------------------------
+ * MULTI-POINT CALIBRATION CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Up to HX711_CAL_MAX_POINTS known weights can be captured on top of the
+ * tare. The points (tared counts, grams) are kept sorted by counts together
+ * with the implicit (0, 0) point, and a Q32 grams-per-count slope is
+ * precomputed per segment. Once a table is present hx711_rawtograms() finds
+ * the segment with a binary search and interpolates with one
+ * multiply/shift, extrapolating along the outer segments; otherwise the
+ * single scale is used as before. Counts are relative to the offset, so
+ * tare and zero tracking keep working with a table in place.
+ */
+#define HX711_CAL_MAX_POINTS           6
+
+/*---------------------------------------------------------------------------------
+ * STREAMING FILTER CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Every sample taken through hx711_update() is pushed into the selected
+ * filter; hx711_getFilteredRaw() then answers from filter state without
+ * re-sampling. Each stage costs O(1) per sample (median: O(N), N small).
+ *
+ * MOVING_AVERAGE : running sum over 2^HX711_FILTER_AVG_WINDOW_LOG2 samples
+ * MEDIAN         : sorted window of HX711_FILTER_MEDIAN_SIZE samples (odd)
+ * IIR            : y += (x - y) / 2^HX711_FILTER_IIR_SHIFT
+ * ADAPTIVE       : IIR whose weight restarts at 1 when a sample differs from
+ *                  the output by more than HX711_ADAPTIVE_STEP_GRAMS, then
+ *                  halves each time the settled run doubles, down to
+ *                  1/2^HX711_ADAPTIVE_MAX_SHIFT. Follows loads immediately
+ *                  and smooths harder the longer the reading is quiet.
+ * KALMAN         : two-state (weight, rate) Kalman filter, see below.
+ */
+#define HX711_FILTER_AVG_WINDOW_LOG2   2   /* 4 samples, 0.4 s at 10 SPS */
+#define HX711_FILTER_MEDIAN_SIZE       5
+#define HX711_FILTER_IIR_SHIFT         2
+#define HX711_ADAPTIVE_STEP_GRAMS      20
+#define HX711_ADAPTIVE_MAX_SHIFT       4   /* at most 1/16 weight when settled */
+
+#define HX711_FILTER_AVG_WINDOW        (1U << HX711_FILTER_AVG_WINDOW_LOG2)
+
+/*---------------------------------------------------------------------------------
+ * KALMAN FILTER CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Constant-velocity model, one measurement per sample:
+ *   weight += rate;  rate += process noise;  raw = weight + noise
+ * Covariances are kept normalised to the measurement variance in Q24, so
+ * the noise settings only enter as ratios and no soft-float runs per
+ * sample: each update is one 32-bit division and a handful of 32x32
+ * multiplies. The gain shrinks as evidence accumulates, giving the
+ * settled accuracy of a long average; an innovation beyond
+ * HX711_KALMAN_GATE_SIGMA standard deviations is taken as a new load and
+ * restarts the estimate from that sample, so a step is followed at once.
+ *
+ * Noise settings are standard deviations (hx711_setKalmanNoise()):
+ *   MEAS   : conversion noise, mg
+ *   WEIGHT : random walk of the load per sample (creep, drift), ug
+ *   RATE   : random walk of the rate per sample (settling motion), ug
+ * The defaults settle to about 30 mg rms from 200 mg samples, roughly a
+ * 45-sample average. Process noise below ~1/4000 of MEAS rounds to zero.
+ */
+#define HX711_KALMAN_MEAS_SIGMA_MG     200
+#define HX711_KALMAN_WEIGHT_SIGMA_UG   1000
+#define HX711_KALMAN_RATE_SIGMA_UG     50
+#define HX711_KALMAN_GATE_SIGMA        6
+
+#define HX711_KALMAN_ONE               (1L << 24)
+#define HX711_KALMAN_P_MAX             0x3FFFFFFFL
+#define HX711_KALMAN_Q24(sigmaUg)      ((sint32)(((uint64)(sigmaUg) * (sigmaUg) << 24) / \
+                                       ((uint64)HX711_KALMAN_MEAS_SIGMA_MG * HX711_KALMAN_MEAS_SIGMA_MG * 1000000ULL)))
+
+/*---------------------------------------------------------------------------------
+ * OUTLIER REJECTION CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Hampel stage ahead of the filter: the newest sample is compared with the
+ * median of the last HX711_OUTLIER_WINDOW raw samples (itself included). If
+ * it is further away than K * 1.4826 * MAD (median absolute deviation,
+ * computed as K * MAD * 3/2), it is replaced by the median and counted.
+ * The threshold never drops below HX711_OUTLIER_MIN_GRAMS so a perfectly
+ * quiet window does not reject ordinary noise. A genuine load change
+ * passes once it holds the majority of the window (W/2 samples later).
+ * Cost per sample: two insertion sorts of W entries.
+ */
+#define HX711_OUTLIER_WINDOW           5
+#define HX711_OUTLIER_K                3
+#define HX711_OUTLIER_MIN_GRAMS        2
+
+/*---------------------------------------------------------------------------------
+ * OVERSAMPLING / DECIMATION CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Optional stage beside the filter: every 2^k samples fed through
+ * hx711_feedSample() are summed in a 32-bit accumulator and emitted as one
+ * decimated sample carrying k/2 extra fractional bits (each 4x of
+ * oversampling halves white noise, i.e. gains one bit). Samples are
+ * HX711_SAMPLE_BITS wide, which leaves room for k <= 31 - HX711_SAMPLE_BITS
+ * (6 with auto-ranging, 7 without).
+ *
+ * Effective bits are reported as HX711_NOISE_FREE_BITS + k/2, where the
+ * base is the noise-free resolution of the raw conversions on this cell at
+ * HX711_SAMPLE_RATE_SPS; measure it and adjust. The output rate is
+ * HX711_SAMPLE_RATE_SPS / 2^k.
+ */
+#define HX711_SAMPLE_RATE_SPS          10  /* RATE pin low; 80 when high */
+#define HX711_NOISE_FREE_BITS          18
+#define HX711_DECIMATE_MAX_LOG2        6
+
+/*---------------------------------------------------------------------------------
+ * MAINS NOTCH (COMB) CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Optional comb stage between outlier rejection and the smoothing filter:
+ * a running mean over 2^HX711_NOTCH_LENGTH_LOG2 samples, whose nulls sit
+ * at every multiple of HX711_SAMPLE_RATE_SPS / length.
+ *
+ * 80 SPS : 8 taps put a null every 10 Hz, where every harmonic of both
+ *          50 and 60 Hz folds (50 -> 30 Hz, 60 -> 20 Hz, 100 -> 20 Hz ...).
+ * 10 SPS : mains and its harmonics fold onto DC, where the HX711's own
+ *          sinc filter already nulls them; the 2-tap comb removes what
+ *          folds to 5 Hz instead (25/75 Hz compressor and mixer ripple).
+ *
+ * Group delay is (length - 1) / 2 samples.
+ */
+#if (HX711_SAMPLE_RATE_SPS == 80)
+#define HX711_NOTCH_LENGTH_LOG2        3
+#else
+#define HX711_NOTCH_LENGTH_LOG2        1
+#endif
+
+#define HX711_NOTCH_LENGTH             (1U << HX711_NOTCH_LENGTH_LOG2)
+
+/*---------------------------------------------------------------------------------
+ * STABILITY (MOTION) DETECTION CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * The scale is stable when the peak-to-peak spread of the last
+ * HX711_STABLE_WINDOW raw samples stays within HX711_STABLE_BAND_GRAMS,
+ * converted to counts from the current calibration scale. Entering the
+ * stable state latches the filtered weight for auto-capture.
+ */
+#define HX711_STABLE_WINDOW            8   /* samples, 0.8 s at 10 SPS */
+#define HX711_STABLE_BAND_GRAMS        5
 
 /*---------------------------------------------------------------------------------
- * PIN CONFIGURATION (for real hardware)
- *---------------------------------------------------------------------------------*/
-#define HX711_DOUT_PORT         PORTB
-#define HX711_DOUT_DDR          DDRB
-#define HX711_DOUT_PIN          PINB
-#define HX711_DOUT_PINNUM       PB4     // Arduino D12
+ * SETTLING PREDICTION CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * While the scale is in motion, samples are averaged in blocks of
+ * 2^HX711_PREDICT_BLOCK_LOG2 and the last three block means are fitted to
+ * an exponential approach (Aitken extrapolation) to predict the final
+ * reading. The prediction is flagged confident when the fit converges
+ * (consecutive differences shrink by at least 1/8) and the last
+ * HX711_PREDICT_AGREE_RUN + 1 predictions agree within
+ * HX711_PREDICT_AGREE_GRAMS of each other. Once the scale is stable the
+ * filtered reading is published instead.
+ */
+#define HX711_PREDICT_BLOCK_LOG2       1   /* 2 samples per block at 10 SPS */
+#define HX711_PREDICT_AGREE_GRAMS      5
+#define HX711_PREDICT_AGREE_RUN        1   /* successive agreements required */
+
+/*---------------------------------------------------------------------------------
+ * AUTOMATIC ZERO TRACKING CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * While enabled, the scale is stable and the filtered weight is within
+ * +/- HX711_ZERO_TRACK_WINDOW_GRAMS of zero, the offset moves 1/2^SHIFT of
+ * the remaining error towards the current reading on every sample. The
+ * offset never leaves +/- HX711_ZERO_TRACK_LIMIT_GRAMS around the reference
+ * (the calibrated offset passed to hx711_init()); tracking is suspended
+ * while a manual tare has put it outside that band.
+ */
+#define HX711_ZERO_TRACK_WINDOW_GRAMS  10
+#define HX711_ZERO_TRACK_LIMIT_GRAMS   50
+#define HX711_ZERO_TRACK_SHIFT         4
+
+/*---------------------------------------------------------------------------------
+ * TARE CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * SAMPLED : hx711_taretozero() always averages fresh conversions
+ *           (hx711_calibrate1setoffset(), up to HX711_PRECISE_MAX_SAMPLES).
+ * INSTANT : when the stability detector reports the scale stable, the
+ *           offset is taken from the live filter output at once; only in
+ *           motion (or before the filter has a sample) does it fall back
+ *           to fresh sampling.
+ */
+#define HX711_TARE_MODE_DEFAULT        HX711_TARE_SAMPLED
+
+/*---------------------------------------------------------------------------------
+ * MULTI-LOAD-CELL PLATFORM CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Several HX711 boards share the SCK line and put their DOUT lines on one
+ * port. A single 24-pulse pass samples the whole PINx register on every
+ * clock, so all cells are read in the time of one and convert in lock-step.
+ * Each cell has its own offset and Q32 reciprocal; the platform weight is
+ * the sum of the cells.
+ *
+ * Cell 0 is the existing DOUT on PB4; PB2, PB3 and PB5 are the free PORTB
+ * pins (PB0/PB1 drive the LCD). Needs the bit-banged transport, since the
+ * SPI transport owns PB2/PB3/PB5.
+ *
+ * Corner-load diagnostic: once the platform carries at least
+ * HX711_MULTI_CORNER_MIN_GRAMS, each cell's share is reported in per-mille
+ * and flagged when it is more than HX711_MULTI_CORNER_IMBALANCE_PERMILLE
+ * away from an even split, or when one cell exceeds its capacity.
+ */
+#define HX711_MULTI_CELL_ENABLED       0   /* 0 = single cell, 1 = platform */
+
+#define HX711_MULTI_CELL_COUNT         4
+#define HX711_MULTI_DOUT_PORT          PORTB
+#define HX711_MULTI_DOUT_DDR           DDRB
+#define HX711_MULTI_DOUT_PIN           PINB
+#define HX711_MULTI_DOUT_PINNUMS       { PB4, PB2, PB3, PB5 }
 
-#define HX711_SCK_PORT          PORTC
-#define HX711_SCK_DDR           DDRC
-#define HX711_SCK_PIN           PINC
-#define HX711_SCK_PINNUM        PC5     // Arduino A5
+#define HX711_MULTI_CORNER_MIN_GRAMS          200
+#define HX711_MULTI_CORNER_IMBALANCE_PERMILLE 150
+#define HX711_MULTI_CELL_CAPACITY_GRAMS       5000L
+
+/*---------------------------------------------------------------------------------
+ * BENCHMARK CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * When enabled, hx711_benchmarkRead() times one conversion readout with
+ * Timer1 running at F_CPU (1 tick = 1 CPU cycle). Timer1 is borrowed for
+ * the duration of the call and its prescaler restored afterwards.
+ *
+ * hx711_benchmarkShiftIn() times the single-loop readout against the
+ * former byte-wise one on two consecutive conversions. Loop overhead is a
+ * fixed number of cycles while the HX711_PULSE_DELAY_US waits cost
+ * 2 * 27 * HX711_PULSE_DELAY_US us at any clock, so rebuild with F_CPU
+ * 1000000 and 16000000 (micro_config.h) to see both ends: at 1 MHz the
+ * loop overhead dominates, at 16 MHz the waits do.
+ *
+ * Benchmark reads discard their samples and keep the chip on the gain of
+ * the conversion in progress, so the interleave schedule and auto-ranging
+ * carry on as if they had not happened.
+ *
+ * Status: unverified. None of the benchmarks (hx711_benchmarkRead(),
+ * hx711_benchmarkShiftIn(), hx711_benchmarkWeight(), hx711_benchmarkNotch())
+ * has been run on the target yet, so the cycle savings claimed for the SPI
+ * readout, the fixed-point weight path, the notch and the single-loop
+ * shift-in are expectations, not measurements. Build with avr-gcc at F_CPU
+ * 1000000 and 16000000, run each one and record the figures here:
+ *
+ *                         1 MHz          16 MHz
+ *   read / irq-off        -              -
+ *   shift-in bytes/loop   -              -
+ *   weight double/fixed   -              -
+ *   notch per sample      -              -
+ */
+#define HX711_BENCHMARK_ENABLED   0  /* 0 = off, 1 = on */
 
 /*---------------------------------------------------------------------------------
  * GAIN/CHANNEL DEFINITIONS
- *---------------------------------------------------------------------------------*/
-#define HX711_GAINCHANNELA128   128     // Channel A, gain 128
-#define HX711_GAINCHANNELA64    64      // Channel A, gain 64
-#define HX711_GAINCHANNELB32    32      // Channel B, gain 32
+ *--------------------------------------------------------------------------------*/
+#define HX711_GAINCHANNELA128   128  /* Channel A, gain 128  */
+#define HX711_GAINCHANNELA64    64   /* Channel A, gain 64   */
+#define HX711_GAINCHANNELB32    32   /* Channel B, gain 32   */
 
 /* Legacy compatibility */
 #define HX711_GAIN_128          HX711_GAINCHANNELA128
@@ -50,140 +368,611 @@
 #define HX711_GAIN_32           HX711_GAINCHANNELB32
 
 /*---------------------------------------------------------------------------------
- * FUNCTION PROTOTYPES
- *---------------------------------------------------------------------------------*/
+ * INTERRUPT-DRIVEN ACQUISITION CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * When enabled, a pin-change interrupt on DOUT (PB4 / PCINT4) clocks each
+ * conversion out as soon as the HX711 signals data-ready and pushes it into
+ * a single-producer/single-consumer ring buffer. The main loop then polls
+ * hx711_tryGetSample() instead of spinning inside hx711_read().
+ *
+ * Acquisition is started at runtime with hx711_startAcquisition().
+ */
+#define HX711_ISR_ACQUISITION_ENABLED      1  /* 0 = polled only, 1 = ISR available */
+
+#define HX711_DOUT_PCICR_BIT    PCIE0         /* PCINT[7:0] group enable      */
+#define HX711_DOUT_PCIFR_BIT    PCIF0         /* PCINT[7:0] group flag        */
+#define HX711_DOUT_PCMSK        PCMSK0
+#define HX711_DOUT_PCINT        PCINT4
+#define HX711_DOUT_PCINT_vect   PCINT0_vect
+
+/* Ring buffer depth in samples - must be a power of two (<= 128) */
+#define HX711_SAMPLE_BUFFER_SIZE           8
+
+/*---------------------------------------------------------------------------------
+ * CHANNEL INTERLEAVING CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * The trailing gain pulses of each read select the channel of the *next*
+ * conversion. While interleaving is active the scheduler programs them one
+ * read ahead so the chip alternates runs of HX711_INTERLEAVE_RUN_A channel A
+ * conversions (gain from hx711_init()) and HX711_INTERLEAVE_RUN_B channel B
+ * conversions (gain 32). The first conversion of every run still settles
+ * after the switch and is dropped, so a run of N yields N-1 samples.
+ *
+ * Channel A samples feed the existing stream (hx711_read(),
+ * hx711_tryGetSample(), the filter); channel B samples are queued
+ * separately for hx711_tryGetChannelBSample().
+ *
+ * Interleaving is started at runtime with hx711_startInterleave().
+ */
+#define HX711_INTERLEAVE_ENABLED           1  /* 0 = channel A only, 1 = A/B available */
+
+#define HX711_INTERLEAVE_RUN_A             8  /* 7 A samples per cycle  */
+#define HX711_INTERLEAVE_RUN_B             2  /* 1 B sample per cycle   */
+
+/* Channel B queue depth in samples - must be a power of two (<= 128) */
+#define HX711_CHANNEL_B_BUFFER_SIZE        4
+
+/*---------------------------------------------------------------------------------
+ * IDLE POWER MANAGEMENT CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Duty-cycle the HX711 (and the bridge excitation it regulates) while the
+ * terminal is idle. Every delivered sample advances an idle count; a
+ * consumer read or hx711_wake() clears it. Once the count reaches the
+ * configured timeout the driver holds SCK high and the chip powers down.
+ *
+ * hx711_wake() powers back up and pre-warms: the first
+ * HX711_WARMUP_DISCARD_SAMPLES conversions after power-up (output settling,
+ * gain reverting to channel A / 128) are dropped, so the stream resumes
+ * with valid samples only. hx711_read() and hx711_tryGetSample() wake the
+ * chip on their own; the application calls hx711_wake() on a key press to
+ * start warming before the weigh screen needs data.
+ *
+ * Idle time is counted in conversions collected by the acquisition ISR,
+ * so the timeout only runs while hx711_startAcquisition() is active. It is
+ * set at runtime with hx711_setIdlePowerDown() (0 = off).
+ */
+#define HX711_AUTO_POWERDOWN_ENABLED       1  /* 0 = manual powerdown only */
+
+#define HX711_IDLE_TIMEOUT_S               30
+#define HX711_WARMUP_DISCARD_SAMPLES       4  /* 400 ms at 10 SPS, 50 ms at 80 SPS */
+
+/*---------------------------------------------------------------------------------
+ * FAULT DETECTION CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * hx711_readTimeout() and hx711_waitSample() never wait longer than asked
+ * and add the time spent without data to a running total; once that
+ * reaches HX711_NO_DATA_TIMEOUT_MS (unplugged cell, dead or powered-down
+ * chip) HX711_FAULT_NO_DATA is raised until data flows again. The blocking
+ * reads (hx711_read(), the averages, tare and calibration) are built on
+ * them: each wait ends at HX711_NO_DATA_TIMEOUT_MS with the fault raised,
+ * the average stops and calibration keeps its previous values. Raising it,
+ * like hx711_wake(), also drops SCK if something left it high, so a chip
+ * powered down behind the driver's back restarts.
+ *
+ * HX711_FAULT_SATURATED is raised after HX711_FAULT_RAIL_SAMPLES
+ * conversions in a row at 0x7FFFFF / 0x800000 (open bridge, overload).
+ * HX711_FAULT_NOISY is raised while the stability spread has stayed above
+ * HX711_FAULT_NOISE_GRAMS for HX711_FAULT_NOISE_SAMPLES filter samples.
+ * All three clear by themselves once the condition goes away.
+ */
+#define HX711_NO_DATA_TIMEOUT_MS       1000
+#define HX711_FAULT_RAIL_SAMPLES       3
+#define HX711_FAULT_NOISE_GRAMS        50
+#define HX711_FAULT_NOISE_SAMPLES      50   /* 5 s at 10 SPS */
+
+/* Fault bits returned by hx711_getFaults() */
+#define HX711_FAULT_NO_DATA            0x01U
+#define HX711_FAULT_SATURATED          0x02U
+#define HX711_FAULT_NOISY              0x04U
+
+/*---------------------------------------------------------------------------------
+ * SAMPLE TIMING CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * hx711_startSampleStats() runs Timer1 free-running at F_CPU /
+ * HX711_TIMER1_PRESCALER and every conversion routed (ISR or polled read)
+ * is stamped with TCNT1. Intervals between stamps give min / max / mean
+ * cadence; an interval longer than 1.5 nominal periods counts the
+ * conversions it skipped as missed (reads held off by LCD writes, long
+ * critical sections). The 16-bit count wraps after 65536 ticks (4.2 s at
+ * 1 MHz), far above one sample period; after power-up or a benchmark
+ * borrowing Timer1 the next interval is skipped.
+ */
+#define HX711_TIMING_ENABLED           1   /* 0 = no Timer1 use */
+
+#define HX711_TIMER1_PRESCALER         64U
+#define HX711_TIMER1_CS_BITS           ((1U << CS11) | (1U << CS10))
+#define HX711_TIMER1_US_PER_TICK       ((HX711_TIMER1_PRESCALER * 1000000UL) / F_CPU)
+#define HX711_NOMINAL_INTERVAL_TICKS   ((uint16)(F_CPU / HX711_TIMER1_PRESCALER / HX711_SAMPLE_RATE_SPS))
+
+/*---------------------------------------------------------------------------------
+ * GAIN AUTO-RANGING CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Extends the range of channel A on high-capacity platforms. While
+ * auto-ranging is active (hx711_enableAutoRange(), channel A set up on gain
+ * 128) a conversion whose raw magnitude reaches HX711_AUTORANGE_HIGH_COUNTS
+ * switches the following conversions to gain 64; once a gain 64 conversion
+ * falls to HX711_AUTORANGE_LOW_COUNTS the driver returns to gain 128. The
+ * low threshold maps below the high one, so a load near a threshold does not
+ * toggle the gain. Like a channel switch, the first conversion at the new
+ * gain is a settling sample and is dropped; so are gain 128 conversions on
+ * the rail while the switch is in flight.
+ *
+ * Gain 64 samples are mapped into gain 128 counts before delivery:
+ *   raw128 = zero128 + (raw64 - zero64) * scale128 / scale64
+ * so the filters, tare, zero tracking and the calibration table see one
+ * continuous signal and the weight does not step at a switch. scale64 and
+ * zero64 come from the calibration: hx711_calibrateLowGainZero() after
+ * hx711_calibrate1setoffset(), then hx711_calibrate2setscale() measures
+ * the known weight at gain 64 as well. The pair is restored with
+ * hx711_setLowGainCalibration(). Without scale64 the nominal ratio of 2
+ * is used about the stored zeros (zero64 = zero128 / 2 if never measured),
+ * so a load that lands beyond the gain 128 rail still maps to its own
+ * weight. Multi-cell reads (HX711_MULTI_CELL_ENABLED) are not auto-ranged.
+ */
+#define HX711_AUTORANGE_ENABLED        1   /* 0 = fixed gain from hx711_init() */
+
+#define HX711_AUTORANGE_HIGH_COUNTS    0x700000L  /* |raw| at 128: 87.5 % of full scale */
+#define HX711_AUTORANGE_LOW_COUNTS     0x300000L  /* |raw| at 64 : 75 % of 128 range    */
+
+#if HX711_AUTORANGE_ENABLED && ((2L * HX711_AUTORANGE_LOW_COUNTS) >= HX711_AUTORANGE_HIGH_COUNTS)
+#error "HX711_AUTORANGE_LOW_COUNTS must map below HX711_AUTORANGE_HIGH_COUNTS"
+#endif
+
+/*
+ * Width of the channel A samples the driver delivers: mapped gain 64
+ * samples reach about +-2^24 and are clamped to 25 bits signed. Sums and
+ * scaled filter state are sized from this (see hx711_readaverage() and
+ * HX711_DECIMATE_MAX_LOG2).
+ */
+#if HX711_AUTORANGE_ENABLED
+#define HX711_SAMPLE_BITS              25
+#else
+#define HX711_SAMPLE_BITS              24
+#endif
+
+/*---------------------------------------------------------------------------------
+ * SAMPLE RECORDER CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Keeps the most recent channel A samples as delivered by the driver (before
+ * any filtering; gain 64 ones already mapped into gain 128 counts) in an
+ * SRAM ring of HX711_RECORDER_BYTES, in the trace format of SIMULATION
+ * CONFIGURATION: one byte per sample while the signal moves less than 127
+ * counts. Timestamps are conversion ticks (1 tick = 1/HX711_SAMPLE_RATE_SPS);
+ * conversions that were not recorded (channel B, warm-up, gain settling,
+ * overruns) appear as gap records. The oldest records are dropped
+ * as new ones arrive. Appending is a few byte stores in whichever context
+ * routes the sample, so the acquisition cadence is unchanged.
+ *
+ * hx711_recorderDump() freezes the ring and streams it over USART0 TX from
+ * the UDRE interrupt without blocking; recording resumes after the last
+ * byte. Dump layout, multi-byte fields big endian:
+ *   'H' 'X'  length(2)  firstTick(4)  baseRaw(4)  records(length)
+ * Records apply to baseRaw; each sample advances the tick by one. Mapped
+ * gain 64 samples reach about +-2^24, so baseRaw and the escape records are
+ * full 32-bit values and the decoder needs no gain information.
+ *
+ * Board conflict: TXD0 is PD1, keypad column 1 (keys 2/5/8/0). TXEN is only
+ * set for the duration of a dump and released from the TX-complete
+ * interrupt, so trigger dumps while the keypad is not scanned (e.g. a
+ * result screen) and do not press column 1 keys meanwhile - the row and
+ * TX drivers would fight through the switch. RXD0 (PD0) is never used.
+ */
+#define HX711_RECORDER_ENABLED             1  /* 0 = no recorder, no USART use */
+
+/* Ring size in bytes - must be a power of two (<= 256) */
+#define HX711_RECORDER_BYTES               128
+#define HX711_RECORDER_BAUD                9600UL  /* U2X: 0.2 % error at 1 MHz */
+
+/*---------------------------------------------------------------------------------
+ * SIMULATION CONFIGURATION
+ *--------------------------------------------------------------------------------*/
+/*
+ * Enable or disable built-in simulation.
+ * When enabled, hx711_read() will generate a synthetic load pattern:
+ *   - ~1.0 kg (± 0.001-0.010 kg noise) for 2000 ms
+ *   - 2.0 kg for 1000 ms
+ *   - back to ~1.0 kg (stable)
+ *
+ * Two more sources replace the pattern for repeatable benchmarks; both
+ * advance simulated time by one sample period per read:
+ *
+ * Trace (hx711_simLoadTrace()): recorded raw samples in a compact
+ * delta format. Each byte is a signed difference (-126..127) to the
+ * previous sample; HX711_SIM_TRACE_ESCAPE is followed by an absolute
+ * 32-bit sample, big endian, and HX711_SIM_TRACE_GAP by a count of
+ * conversions that were not recorded (1..255; a count byte of 0 is
+ * followed by the full 32-bit count, big endian). A trace starts with an
+ * absolute sample so it can loop. The sample recorder uses the same format.
+ * hx711_simEncodeTrace() produces the format. In a host build with
+ * HX711_SIM_HOST_FILE set, hx711_simLoadTraceFile() reads a text file of
+ * decimal raw samples, one per line.
+ *
+ * Scenario (hx711_simRunScenario()): a scripted load in grams converted
+ * with the current scale and offset, plus deterministic noise:
+ *   STEP      : base, then base + step at startMs, settling with tauMs
+ *   DRIFT     : base + driftMgPerS from startMs on (zero / thermal drift)
+ *   VIBRATION : STEP plus a sine of amplitudeGrams and periodMs throughout
+ *   CREEP     : STEP, then amplitudeGrams more approached with tauMs
+ *
+ * hx711_simBenchmark() runs the active source through the filter chain and
+ * reports samples-to-stable and the settled output noise.
+ */
+#define HX711_SIMULATION_ENABLED_DEFAULT   0  /* 0 = off, 1 = on */
+
+#define HX711_SIM_TICK_MS                  (1000U / HX711_SAMPLE_RATE_SPS)
+#define HX711_SIM_TRACE_ESCAPE             0x80U
+#define HX711_SIM_TRACE_GAP                0x81U
+
+#ifndef HX711_SIM_HOST_FILE
+#define HX711_SIM_HOST_FILE                0  /* 1 = host build, stdio available */
+#endif
+#define HX711_SIM_FILE_BUFFER_BYTES        8192U
+
+/*---------------------------------------------------------------------------------
+ * TYPES
+ *--------------------------------------------------------------------------------*/
+
+/*
+ * Streaming filter selection (see STREAMING FILTER CONFIGURATION).
+ */
+typedef enum
+{
+    HX711_FILTER_NONE = 0,
+    HX711_FILTER_MOVING_AVERAGE,
+    HX711_FILTER_MEDIAN,
+    HX711_FILTER_IIR,
+    HX711_FILTER_ADAPTIVE,
+    HX711_FILTER_KALMAN
+} HX711_FilterType_t;
+
+/*
+ * Result of hx711_readPreciseAverage().
+ *
+ * mean          : averaged raw reading (counts)
+ * samples       : readings taken
+ * semMilligrams : standard error of the mean achieved, in mg at the
+ *                 current scale
+ * converged     : 1 if the target was met before the sample cap
+ */
+typedef struct
+{
+    sint32 mean;
+    uint8  samples;
+    uint32 semMilligrams;
+    uint8  converged;
+} HX711_AverageResult_t;
+
+/*
+ * Input channel of a conversion.
+ */
+typedef enum
+{
+    HX711_CHANNEL_A = 0,
+    HX711_CHANNEL_B
+} HX711_Channel_t;
+
+/*
+ * Result of hx711_benchmarkNotch() over a recorded trace, after the comb
+ * has filled.
+ *
+ * inputRipple     : peak-to-peak of the raw trace (counts)
+ * outputRipple    : peak-to-peak after the comb (counts)
+ * cyclesPerSample : comb cost per sample in CPU cycles
+ */
+typedef struct
+{
+    sint32 inputRipple;
+    sint32 outputRipple;
+    uint16 cyclesPerSample;
+} HX711_NotchBenchmark_t;
+
+/*
+ * Scripted simulation load (see SIMULATION CONFIGURATION).
+ */
+typedef enum
+{
+    HX711_SCENARIO_STEP = 0,
+    HX711_SCENARIO_DRIFT,
+    HX711_SCENARIO_VIBRATION,
+    HX711_SCENARIO_CREEP
+} HX711_ScenarioType_t;
+
+typedef struct
+{
+    HX711_ScenarioType_t type;
+    sint32 baseGrams;           /* load before the event                  */
+    sint32 stepGrams;           /* load added at startMs                  */
+    uint32 startMs;
+    uint16 tauMs;               /* STEP / CREEP time constant, 0 = instant */
+    sint32 amplitudeGrams;      /* VIBRATION peak, CREEP total            */
+    uint16 periodMs;            /* VIBRATION period                       */
+    sint32 driftMgPerS;         /* DRIFT slope                            */
+    uint16 noiseMg;             /* peak noise, deterministic              */
+} HX711_Scenario_t;
+
+/*
+ * Outcome of hx711_simBenchmark().
+ */
+typedef struct
+{
+    uint16 samplesToStable;     /* run start to final settle, 0xFFFF = not */
+    uint32 settledNoiseMg;      /* filtered peak-to-peak once stable       */
+    sint32 finalGrams;
+} HX711_SimBenchmark_t;
+
+/*
+ * Conversion cadence (see SAMPLE TIMING CONFIGURATION).
+ */
+typedef struct
+{
+    uint32 minIntervalUs;
+    uint32 maxIntervalUs;
+    uint32 meanIntervalUs;
+    uint16 intervals;           /* measured since the last reset           */
+    uint16 missed;              /* conversions not collected in time       */
+    uint8  overruns;            /* samples dropped, ring buffer full       */
+} HX711_SampleStats_t;
+
+/*
+ * Result of the bounded-wait reads (see FAULT DETECTION CONFIGURATION).
+ */
+typedef enum
+{
+    HX711_STATUS_OK = 0,        /* sample available / delivered           */
+    HX711_STATUS_NOT_READY,     /* nothing yet, no-data timeout not hit   */
+    HX711_STATUS_TIMEOUT,       /* no data for HX711_NO_DATA_TIMEOUT_MS   */
+    HX711_STATUS_SATURATED      /* sample delivered but at a rail         */
+} HX711_Status_t;
+
+/*
+ * Tare behaviour of hx711_taretozero() (see TARE CONFIGURATION).
+ */
+typedef enum
+{
+    HX711_TARE_SAMPLED = 0,
+    HX711_TARE_INSTANT
+} HX711_TareMode_t;
+
+/*
+ * Result of hx711_benchmarkRead(), in CPU cycles.
+ *
+ * readCycles   : data-ready to sample assembled (24 bits + gain pulses)
+ * irqOffCycles : longest stretch with interrupts disabled during that read
+ */
+typedef struct
+{
+    uint16 readCycles;
+    uint16 irqOffCycles;
+} HX711_Benchmark_t;
+
+/*
+ * Result of hx711_benchmarkShiftIn(): one readout (24 bits + gain pulses,
+ * sign-extended) each way, in CPU cycles and in microseconds at F_CPU.
+ *
+ * bytesCycles : three 8-bit shifts, gain pulses, filler reassembly
+ * loopCycles  : single 24 + pulses loop into a 32-bit register
+ */
+typedef struct
+{
+    uint16 bytesCycles;
+    uint16 loopCycles;
+    uint16 bytesUs;
+    uint16 loopUs;
+} HX711_ShiftInBenchmark_t;
+
+/*
+ * Result of hx711_benchmarkWeight(), in CPU cycles for one conversion of the
+ * same raw sample.
+ *
+ * doubleCycles : (raw - offset) / scale in double
+ * fixedCycles  : Q32 reciprocal multiply to grams
+ */
+typedef struct
+{
+    uint16 doubleCycles;
+    uint16 fixedCycles;
+} HX711_WeightBenchmark_t;
+
+/*
+ * Result of hx711_multiGetCornerLoad().
+ *
+ * shares        : per-cell share of the platform weight, per-mille
+ * heaviestCell  : index of the cell carrying the most load
+ * maxDeviation  : largest distance of any share from an even split, per-mille
+ * imbalanced    : 1 when maxDeviation exceeds the configured limit
+ * overloadMask  : bit n set when cell n is above its capacity
+ */
+typedef struct
+{
+    uint16 shares[HX711_MULTI_CELL_COUNT];
+    uint8  heaviestCell;
+    uint16 maxDeviation;
+    uint8  imbalanced;
+    uint8  overloadMask;
+} HX711_CornerLoad_t;
+
+/*---------------------------------------------------------------------------------
+ * PUBLIC API
+ *--------------------------------------------------------------------------------*/
 
-/* Initialization - matches your original function name */
-void hx711_init(uint8 gain, double scale, sint32 offset);
+/* Initialization */
+void   hx711_init(uint8 gain, double scale, sint32 offset);
 
-/* Check if ready */
-uint8 hx711_isready(void);
+/* Ready check */
+uint8  hx711_isready(void);
 
-/* Read functions - matches your original naming */
+/* Raw read & averaging */
 sint32 hx711_read(void);
 sint32 hx711_readaverage(uint8 times);
+
+/* Precision-terminated averaging - returns 1 if the target was met */
+uint8  hx711_readPreciseAverage(uint16 targetMilligrams, uint8 maxSamples,
+                                HX711_AverageResult_t *result);
+void   hx711_getLastAverageResult(HX711_AverageResult_t *result);
+
+/* Interrupt-driven acquisition (non-blocking) */
+void   hx711_startAcquisition(void);
+void   hx711_stopAcquisition(void);
+uint8  hx711_isAcquisitionActive(void);
+uint8  hx711_tryGetSample(sint32 *sample);
+uint8  hx711_getPendingSamples(void);
+uint8  hx711_getOverrunCount(void);
+
+/* Sample timestamps and cadence statistics (HX711_TIMING_ENABLED) */
+void   hx711_startSampleStats(void);
+void   hx711_resetSampleStats(void);
+void   hx711_getSampleStats(HX711_SampleStats_t *stats);
+uint8  hx711_tryGetTimedSample(sint32 *sample, uint16 *stamp);
+
+/* Gain auto-ranging 128 <-> 64 (HX711_AUTORANGE_ENABLED) */
+uint8  hx711_enableAutoRange(void);
+void   hx711_disableAutoRange(void);
+uint8  hx711_isAutoRangeEnabled(void);
+void   hx711_setLowGainCalibration(double scale, sint32 offset);
+uint8  hx711_getLowGainCalibration(double *scale, sint32 *offset);
+
+/* Raw sample recorder (HX711_RECORDER_ENABLED) */
+void   hx711_enableRecorder(void);
+void   hx711_disableRecorder(void);
+uint8  hx711_recorderDump(void);
+uint8  hx711_isRecorderDumping(void);
+
+/* Bounded-wait reads and fault state */
+HX711_Status_t hx711_readTimeout(sint32 *value, uint16 timeoutMs);
+HX711_Status_t hx711_waitSample(uint16 timeoutMs);
+uint8  hx711_getFaults(void);
+
+/* Channel A/B interleaving - channel A stays on the acquisition API above */
+uint8  hx711_startInterleave(void);
+void   hx711_stopInterleave(void);
+uint8  hx711_isInterleaveActive(void);
+uint8  hx711_tryGetChannelBSample(sint32 *sample);
+
+/* Streaming filter */
+void   hx711_setFilter(HX711_FilterType_t type);
+HX711_FilterType_t hx711_getFilter(void);
+void   hx711_resetFilter(void);
+void   hx711_feedSample(sint32 raw);
+uint8  hx711_update(void);
+sint32 hx711_getFilteredRaw(void);
+uint8  hx711_isFilterPrimed(void);
+
+/* Kalman filter (HX711_FILTER_KALMAN) */
+void   hx711_setKalmanNoise(uint16 measMg, uint16 weightUg, uint16 rateUg);
+sint32 hx711_getRateMilligramsPerSecond(void);
+
+/* Outlier rejection (Hampel) */
+void   hx711_enableOutlierRejection(void);
+void   hx711_disableOutlierRejection(void);
+uint16 hx711_getRejectedCount(void);
+void   hx711_clearRejectedCount(void);
+
+/* Mains notch (comb) stage */
+void   hx711_enableNotch(void);
+void   hx711_disableNotch(void);
+uint8  hx711_isNotchEnabled(void);
+
+/* Oversampling / decimation - samples are raw counts << hx711_getDecimationFracBits() */
+void   hx711_setDecimation(uint8 log2Samples);
+uint8  hx711_getDecimation(void);
+uint8  hx711_tryGetDecimatedSample(sint32 *sample);
+uint8  hx711_getDecimationFracBits(void);
+uint8  hx711_getEffectiveBits(void);
+uint32 hx711_getDecimatedRateMilliHz(void);
+sint32 hx711_decimatedToMilligrams(sint32 sample);
+
+/* Stability detection */
+uint8  hx711_isStable(void);
+uint8  hx711_getStableWeightGrams(sint32 *grams);
+void   hx711_clearStableLatch(void);
+
+/* Settling prediction - returns 1 when the prediction is trustworthy */
+uint8  hx711_getPredictedWeightGrams(sint32 *grams);
+
+/* Automatic zero tracking */
+void   hx711_enableZeroTracking(void);
+void   hx711_disableZeroTracking(void);
+void   hx711_setZeroTrackingReference(sint32 reference);
+sint32 hx711_getZeroTrackingCorrection(void);
+
+/* Calibrated weight (kg) */
 double hx711_getweight(void);
 
-/* Calibration functions - matches your original naming */
-void hx711_calibrate1setoffset(void);
-void hx711_calibrate2setscale(double knownWeight);
-void hx711_taretozero(void);
+/* Calibrated weight, fixed-point (grams) */
+sint32 hx711_getweightgrams(void);
+sint32 hx711_rawtograms(sint32 raw);
 
-/* Getter/Setter functions - matches your original naming */
-void hx711_setscale(double scale);
+/* Calibration helpers */
+void   hx711_calibrate1setoffset(void);
+void   hx711_calibrateLowGainZero(void);
+void   hx711_calibrate2setscale(double knownWeight);
+uint8  hx711_taretozero(void);
+void   hx711_setTareMode(HX711_TareMode_t mode);
+HX711_TareMode_t hx711_getTareMode(void);
+
+/* Multi-point calibration - counts are relative to the offset */
+void   hx711_clearCalibrationPoints(void);
+uint8  hx711_addCalibrationPoint(sint32 grams);
+uint8  hx711_setCalibrationPoints(const sint32 *counts, const sint32 *grams, uint8 count);
+uint8  hx711_getCalibrationPoints(sint32 *counts, sint32 *grams);
+
+/* Scale/offset getters & setters */
+void   hx711_setscale(double scale);
 double hx711_getscale(void);
-void hx711_setoffset(sint32 offset);
+
+void   hx711_setoffset(sint32 offset);
 sint32 hx711_getoffset(void);
-uint8 hx711_getgain(void);
+
+void   hx711_setscalerecip(sint32 scaleRecip);
+sint32 hx711_getscalerecip(void);
+
+uint8  hx711_getgain(void);
+
+/* Multi-load-cell platform (HX711_MULTI_CELL_ENABLED) */
+void   hx711_multiInit(void);
+uint8  hx711_multiIsReady(void);
+uint8  hx711_multiRead(sint32 *raw);
+uint8  hx711_multiTryRead(sint32 *raw);
+void   hx711_multiTare(uint8 times);
+void   hx711_multiSetCellOffset(uint8 cell, sint32 offset);
+sint32 hx711_multiGetCellOffset(uint8 cell);
+void   hx711_multiSetCellScale(uint8 cell, double scale);
+void   hx711_multiSetCellScaleRecip(uint8 cell, sint32 scaleRecip);
+sint32 hx711_multiGetCellScaleRecip(uint8 cell);
+sint32 hx711_multiGetCellGrams(uint8 cell);
+sint32 hx711_multiGetPlatformGrams(void);
+uint8  hx711_multiGetCornerLoad(HX711_CornerLoad_t *result);
 
 /* Power management */
-void hx711_powerdown(void);
-void hx711_powerup(void);
+void   hx711_powerdown(void);
+void   hx711_powerup(void);
+void   hx711_setIdlePowerDown(uint16 seconds);
+void   hx711_wake(void);
+uint8  hx711_isPoweredDown(void);
+
+/* Readout timing (HX711_BENCHMARK_ENABLED) - returns 1 on success */
+uint8  hx711_benchmarkRead(HX711_Benchmark_t *result);
+uint8  hx711_benchmarkShiftIn(HX711_ShiftInBenchmark_t *result);
+uint8  hx711_benchmarkWeight(sint32 raw, HX711_WeightBenchmark_t *result);
+uint8  hx711_benchmarkNotch(const sint32 *trace, uint16 length, HX711_NotchBenchmark_t *result);
+
+/* Simulation control (optional) */
+void   hx711_enableSimulation(void);
+void   hx711_disableSimulation(void);
+void   hx711_startSimulationPattern(void);
+void   hx711_stopSimulationPattern(void);
+void   hx711_simLoadTrace(const uint8 *data, uint16 length, uint8 loop);
+uint8  hx711_simLoadTraceFile(const char *path, uint8 loop);
+uint16 hx711_simEncodeTrace(const sint32 *raw, uint16 count, uint8 *out, uint16 capacity);
+void   hx711_simRunScenario(const HX711_Scenario_t *scenario);
+uint8  hx711_simIsFinished(void);
+void   hx711_simBenchmark(uint16 samples, HX711_SimBenchmark_t *result);
 
 #endif /* HX711_H_ */
-=======
-/******************************************************************************
- * HX711 library for AVR ATmega328P
- * With optional Proteus / software simulation support
- * Converted and extended for Fruit Weighing System project
- *
- * Original Arduino C++ library:
- *   https://github.com/bogde/HX711
- *
- * MIT License - (c) 2018 Bogdan Necula
- * C conversion & extensions: Ahmed Abdelaal - 2025
- *
- ******************************************************************************/
-
-#ifndef HX711_H_
-#define HX711_H_
-
-/*---------------------------------------------------------------------------------
- * INCLUDES
- *--------------------------------------------------------------------------------*/
-#include "std_types.h"
-#include "micro_config.h"
-#include "common_macros.h"
-
-/*---------------------------------------------------------------------------------
- * PIN CONFIGURATION (REAL HARDWARE)
- *--------------------------------------------------------------------------------*/
-/* DOUT (data) on PB4 (Arduino D12) */
-#define HX711_DOUT_PORT      PORTB
-#define HX711_DOUT_DDR       DDRB
-#define HX711_DOUT_PIN       PINB
-#define HX711_DOUT_PINNUM    PB4
-
-/* SCK (clock) on PC5 (Arduino A5) */
-#define HX711_SCK_PORT       PORTC
-#define HX711_SCK_DDR        DDRC
-#define HX711_SCK_PIN        PINC
-#define HX711_SCK_PINNUM     PC5
-
-/*---------------------------------------------------------------------------------
- * GAIN/CHANNEL DEFINITIONS
- *--------------------------------------------------------------------------------*/
-#define HX711_GAINCHANNELA128   128  /* Channel A, gain 128  */
-#define HX711_GAINCHANNELA64    64   /* Channel A, gain 64   */
-#define HX711_GAINCHANNELB32    32   /* Channel B, gain 32   */
-
-/* Legacy compatibility */
-#define HX711_GAIN_128          HX711_GAINCHANNELA128
-#define HX711_GAIN_64           HX711_GAINCHANNELA64
-#define HX711_GAIN_32           HX711_GAINCHANNELB32
-
-/*---------------------------------------------------------------------------------
- * SIMULATION CONFIGURATION
- *--------------------------------------------------------------------------------*/
-/*
- * Enable or disable built-in simulation.
- * When enabled, hx711_read() will generate a synthetic load pattern:
- *   - ~1.0 kg (± 0.001-0.010 kg noise) for 2000 ms
- *   - 2.0 kg for 1000 ms
- *   - back to ~1.0 kg (stable)
- */
-#define HX711_SIMULATION_ENABLED_DEFAULT   0  /* 0 = off, 1 = on */
-
-/*---------------------------------------------------------------------------------
- * PUBLIC API
- *--------------------------------------------------------------------------------*/
-
-/* Initialization */
-void   hx711_init(uint8 gain, double scale, sint32 offset);
-
-/* Ready check */
-uint8  hx711_isready(void);
-
-/* Raw read & averaging */
-float32 hx711_read(void);
-float32 hx711_readaverage(uint8 times);
-
-/* Calibrated weight (kg) */
-double hx711_getweight(void);
-
-/* Calibration helpers */
-void   hx711_calibrate1setoffset(void);
-void   hx711_calibrate2setscale(double knownWeight);
-void   hx711_taretozero(void);
-
-/* Scale/offset getters & setters */
-void   hx711_setscale(double scale);
-double hx711_getscale(void);
-
-void   hx711_setoffset(sint32 offset);
-sint32 hx711_getoffset(void);
-
-uint8  hx711_getgain(void);
-
-/* Power management */
-void   hx711_powerdown(void);
-void   hx711_powerup(void);
-
-/* Simulation control (optional) */
-void   hx711_enableSimulation(void);
-void   hx711_disableSimulation(void);
-void   hx711_startSimulationPattern(void);
-void   hx711_stopSimulationPattern(void);
-
-#endif /* HX711_H_ */
->>>>>>> edc6387c1d585a5baaf460e549f88eece77f0548
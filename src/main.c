@@ -1,4 +1,3 @@
-<<<<<<< HEAD
 /***********************************************************************************
  *                                                                                 *
  * [MODULE]: Application                                                           *
@@ -24,6 +23,14 @@
 #define MAX_PASSWORD_LENGTH 6
 #define MAX_PRICE_DIGITS 8
 #define DECIMAL_PLACES 3
+#define MIN_CAPTURE_GRAMS 20 /* Smallest settled load that is auto-captured */
+#define CAPTURE_HOLD_SAMPLES 10 /* Settled samples shown before auto-capture (time to tare) */
+#define WEIGH_POLL_MS 20      /* Longest wait for a conversion between key scans */
+#define DIAG_REFRESH_MS 500   /* Diagnostics screen update period */
+
+#if (APPDATA_HX711_CAL_MAX_POINTS != HX711_CAL_MAX_POINTS)
+#error "EEPROM calibration table and HX711 table sizes differ"
+#endif
 
 /*---------------------------------------------------------------------------------*
  *                                     ENUMS                                       *
@@ -38,6 +45,7 @@ typedef enum
     STATE_UPDATE_PASSWORD,
     STATE_VIEW_INCOME,
     STATE_CALIBRATE_SCALE,
+    STATE_DIAGNOSTICS,
     STATE_USER_BROWSE_ITEMS,
     STATE_USER_WEIGH_ITEM,
     STATE_USER_CHECKOUT,
@@ -79,7 +87,9 @@ void App_handleUpdatePrice(void);
 void App_handleUpdatePassword(void);
 void App_handleViewIncome(void);
 void performScaleCalibration(void);
+void performCalibrationPoints(void);
 void App_handleCalibrateScale(void);
+void App_handleDiagnostics(void);
 
 /* User Functions */
 void App_handleUserBrowseItems(void);
@@ -100,6 +110,9 @@ void App_displayDouble(double value);
 void App_showMessage(const char *line1, const char *line2, uint16 delayMs);
 void App_showError(const char *message);
 void App_showSuccess(const char *message);
+void App_showAverageResult(void);
+void App_showScaleFault(uint8 faults);
+uint8 App_checkScaleLost(void);
 
 /* Validation */
 uint8 App_validatePrice(float price);
@@ -116,6 +129,10 @@ int main(void)
 
     while (1)
     {
+        /* Every handler returns on a key press: keep the scale awake and, if
+         * it was idle, start warming it before a weigh screen needs data */
+        hx711_wake();
+
         switch (g_currentState)
         {
         case STATE_ROLE_SELECT:
@@ -144,6 +161,9 @@ int main(void)
         case STATE_CALIBRATE_SCALE:
             App_handleCalibrateScale();
             break;
+        case STATE_DIAGNOSTICS:
+            App_handleDiagnostics();
+            break;
         case STATE_USER_BROWSE_ITEMS:
             App_handleUserBrowseItems();
             break;
@@ -179,6 +199,12 @@ void App_init(void)
 {
     double saved_scale;
     int32_t saved_offset;
+    int32_t saved_scaleRecip;
+    sint32 saved_pointCounts[APPDATA_HX711_CAL_MAX_POINTS];
+    sint32 saved_pointGrams[APPDATA_HX711_CAL_MAX_POINTS];
+    uint8 saved_pointCount;
+    double saved_lowGainScale;
+    int32_t saved_lowGainOffset;
     EEPROM_Config_t eepromConfig;
 
     LCD_init();
@@ -196,12 +222,42 @@ void App_init(void)
         performScaleCalibration();
     }
 
-    if (AppData_loadCalibration(&saved_scale, &saved_offset) == APPDATA_NO_ERROR)
+    if (AppData_loadCalibration(&saved_scale, &saved_offset, &saved_scaleRecip) == APPDATA_NO_ERROR)
     {
         hx711_init(HX711_GAINCHANNELA128, saved_scale, saved_offset);
+        /* Older calibrations only stored the scale; init already derived it */
+        if (saved_scaleRecip != APPDATA_HX711_SCALE_RECIP_ERASED)
+        {
+            hx711_setscalerecip(saved_scaleRecip);
+        }
+        /* Gain 64 pair for auto-ranging; pairs with the offset just loaded */
+        if (AppData_loadLowGainCalibration(&saved_lowGainScale, &saved_lowGainOffset) == APPDATA_NO_ERROR)
+        {
+            hx711_setLowGainCalibration(saved_lowGainScale, saved_lowGainOffset);
+        }
+        /* Multi-point table, if one was captured, replaces the single scale */
+        if (AppData_loadCalibrationPoints(saved_pointCounts, saved_pointGrams, &saved_pointCount) == APPDATA_NO_ERROR &&
+            saved_pointCount > 0)
+        {
+            hx711_setCalibrationPoints(saved_pointCounts, saved_pointGrams, saved_pointCount);
+        }
         /* Initialize HX711 with saved calibration */
         App_showMessage("Calibration", "Loaded!", 500);
     }
+
+    /* Let the DOUT interrupt collect samples in the background */
+    hx711_enableOutlierRejection();
+    hx711_setFilter(HX711_FILTER_ADAPTIVE);
+    hx711_enableZeroTracking();
+    hx711_setTareMode(HX711_TARE_INSTANT);
+    hx711_enableAutoRange();
+    hx711_enableRecorder();
+    hx711_startAcquisition();
+    hx711_startSampleStats();
+    hx711_setIdlePowerDown(HX711_IDLE_TIMEOUT_S);
+
+    /* Sources are armed; let the acquisition ISR run */
+    sei();
 }
 
 /*---------------------------------------------------------------------------------*/
@@ -292,8 +348,8 @@ void App_handleAdminLogin(void)
 void App_displayAdminMenu(void)
 {
     LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "1:Price 2:Pass");
-    LCD_displayStringRowColumn(1, 0, "3:$ 4:Cal 0:Out");
+    LCD_displayStringRowColumn(0, 0, "1:Prc 2:Pass 3:$");
+    LCD_displayStringRowColumn(1, 0, "4:Cal 5:Dg 0:Out");
 }
 
 /*---------------------------------------------------------------------------------*/
@@ -333,6 +389,10 @@ void App_handleAdminMenu(void)
         g_currentState = STATE_CALIBRATE_SCALE; /* NEW */
         break;
 
+    case '5':
+        g_currentState = STATE_DIAGNOSTICS;
+        break;
+
     case '0':
         g_currentState = STATE_LOGOUT;
         break;
@@ -431,6 +491,12 @@ void App_handleUserWeighItem(void)
     float itemTotal;
     char itemName[17];
     uint8 key;
+    sint32 stableGrams;
+    HX711_Status_t status;
+    uint8 faults;
+    uint8 shownFaults = 0;
+    uint8 holdSamples = 0;
+    uint8 tarePending = 0;
 
     /* Get item data */
     AppData_loadItemName(g_currentItemIndex, itemName);
@@ -439,23 +505,24 @@ void App_handleUserWeighItem(void)
     /* Step 3: Ask to place weight */
     LCD_clearScreen();
     LCD_displayStringRowColumn(0, 0, "Place weight");
-    LCD_displayStringRowColumn(1, 0, "then press #");
+    LCD_displayStringRowColumn(1, 0, "#:OK  C:Tare");
     _delay_ms(1000);
 
+    /* Start averaging from fresh samples, not what queued up meanwhile */
+    hx711_resetFilter();
+
     /* Step 4: Show real-time weight */
+    weight = 0.0f;
     while (1)
     {
-        weight = getWeight();
-        _delay_ms(100);
-        LCD_clearScreen();
-        LCD_displayStringRowColumn(0, 0, "Weight:");
-        LCD_goToRowColumn(1, 0);
-        App_displayFloat(weight);
-        LCD_displayString(" KG");
+        /* Refresh only when a conversion is ready; the bounded wait keeps keys
+         * scanned and notices a silent or faulty HX711 */
+        status = hx711_waitSample(WEIGH_POLL_MS);
+        faults = hx711_getFaults();
 
-        /* Check for confirmation */
+        /* Keys first, so a tare always wins over auto-capture of a container */
         key = KEYPAD_getPressedKeyNonBlocking();
-        if (key == '#')
+        if (key == '#' && faults == 0) /* Confirm (never on a faulty reading) */
         {
             break;
         }
@@ -464,8 +531,70 @@ void App_handleUserWeighItem(void)
             g_currentState = STATE_USER_BROWSE_ITEMS;
             return;
         }
+        else if (key == 'C') /* Tare (e.g. a container on the platter) */
+        {
+            /* Taken once the load is steady: the instant tare never blocks */
+            tarePending = 1;
+            holdSamples = 0;
+        }
+
+        if (faults != 0)
+        {
+            /* Keep draining the queue so recovery shows fresh data */
+            if (status == HX711_STATUS_OK)
+            {
+                (void)getWeight();
+            }
+            if (faults != shownFaults)
+            {
+                App_showScaleFault(faults);
+                shownFaults = faults;
+            }
+            weight = 0.0f;
+        }
+        else if (status == HX711_STATUS_OK)
+        {
+            shownFaults = 0;
+            weight = getWeight();
+
+            if (tarePending && hx711_isStable())
+            {
+                hx711_taretozero();
+                hx711_clearStableLatch();
+                tarePending = 0;
+                weight = getWeight();
+            }
+
+            LCD_clearScreen();
+            LCD_displayStringRowColumn(0, 0, tarePending ? "Weight: taring.." : "Weight:");
+            LCD_goToRowColumn(1, 0);
+            App_displayFloat(weight);
+            LCD_displayString(" KG");
+
+            /* Auto-capture once the settling fit is trustworthy, or at the
+             * latest once the load settles - after a short hold that leaves
+             * time to tare a container instead */
+            if (!tarePending &&
+                ((hx711_getPredictedWeightGrams(&stableGrams) && stableGrams >= MIN_CAPTURE_GRAMS) ||
+                 (hx711_getStableWeightGrams(&stableGrams) && stableGrams >= MIN_CAPTURE_GRAMS)))
+            {
+                if (++holdSamples >= CAPTURE_HOLD_SAMPLES)
+                {
+                    weight = (float)stableGrams * 0.001f;
+                    break;
+                }
+            }
+            else
+            {
+                holdSamples = 0;
+            }
+        }
     }
 
+    /* Stream what the ADC saw up to the capture; the total screen below
+     * does not scan the keypad, whose column 1 shares the TX pin */
+    hx711_recorderDump();
+
     /* Step 5: Calculate price */
     itemTotal = weight * unitPrice;
     g_sessionTotal += (double)itemTotal;
@@ -559,18 +688,13 @@ float getWeight(void)
      * Uses the library's built-in calibrated reading
      */
 
-    double weight_kg;
-
-    // Get weight using library function (returns calibrated value)
-    weight_kg = hx711_getweight();
+    sint32 weight_g;
 
-    // Ensure non-negative weight
-    if (weight_kg < 0.0)
-    {
-        weight_kg = 0.0;
-    }
+    // Get weight using library fixed-point path (grams, clamped at zero)
+    weight_g = hx711_getweightgrams();
 
-    return (float)weight_kg;
+    // Scale to kilograms for display (multiply, no soft-float division)
+    return (float)weight_g * 0.001f;
 }
 
 /*---------------------------------------------------------------------------------*/
@@ -752,10 +876,82 @@ void App_handleViewIncome(void)
     g_currentState = STATE_ADMIN_MENU;
 }
 
+/*---------------------------------------------------------------------------------*/
+void App_handleDiagnostics(void)
+{
+    HX711_SampleStats_t stats;
+    sint32 raw;
+    uint8 pending;
+    uint8 page = 0;
+    uint8 key;
+    uint16 elapsed = DIAG_REFRESH_MS;
+
+    while (1)
+    {
+        if (elapsed >= DIAG_REFRESH_MS)
+        {
+            elapsed = 0;
+
+            /* Keep converting and drain the queue so only real overruns count;
+             * bounded by what is queued now (simulation never runs dry) */
+            hx711_wake();
+            pending = hx711_getPendingSamples();
+            while ((pending-- > 0) && hx711_tryGetSample(&raw))
+            {
+            }
+
+            hx711_getSampleStats(&stats);
+
+            LCD_clearScreen();
+            if (page == 0)
+            {
+                LCD_displayStringRowColumn(0, 0, "Min ms:");
+                App_displayFloat((float)stats.minIntervalUs * 0.001f);
+                LCD_displayStringRowColumn(1, 0, "Max ms:");
+                App_displayFloat((float)stats.maxIntervalUs * 0.001f);
+            }
+            else
+            {
+                LCD_displayStringRowColumn(0, 0, "Mean ms:");
+                App_displayFloat((float)stats.meanIntervalUs * 0.001f);
+                LCD_displayStringRowColumn(1, 0, "Miss:");
+                LCD_displayInteger((int)stats.missed);
+                LCD_displayString(" Ovr:");
+                LCD_displayInteger((int)stats.overruns);
+            }
+        }
+
+        /* A: next page  C: clear  *: back */
+        key = KEYPAD_getPressedKeyNonBlocking();
+        if (key == 'A' || key == 'a')
+        {
+            page ^= 1;
+            elapsed = DIAG_REFRESH_MS;
+            KEYPAD_waitForRelease();
+        }
+        else if (key == 'C' || key == 'c')
+        {
+            hx711_resetSampleStats();
+            elapsed = DIAG_REFRESH_MS;
+            KEYPAD_waitForRelease();
+        }
+        else if (key == '*')
+        {
+            break;
+        }
+
+        _delay_ms(WEIGH_POLL_MS);
+        elapsed += WEIGH_POLL_MS;
+    }
+
+    g_currentState = STATE_ADMIN_MENU;
+}
+
 /*---------------------------------------------------------------------------------*/
 void App_handleCalibrateScale(void)
 {
     uint8 key;
+    sint32 probe;
     /* Display calibration intro */
     LCD_clearScreen();
     LCD_displayStringRowColumn(0, 0, "Scale Calibrate");
@@ -767,6 +963,15 @@ void App_handleCalibrateScale(void)
         g_currentState = STATE_ADMIN_MENU;
         return;
     }
+
+    /* Calibration averages block on the HX711: make sure it answers first */
+    if (hx711_readTimeout(&probe, HX711_NO_DATA_TIMEOUT_MS) != HX711_STATUS_OK)
+    {
+        App_showScaleFault(hx711_getFaults());
+        _delay_ms(2000);
+        g_currentState = STATE_ADMIN_MENU;
+        return;
+    }
     performScaleCalibration();
     /* Return to admin menu */
     g_currentState = STATE_ADMIN_MENU;
@@ -953,6 +1158,69 @@ void App_showSuccess(const char *message)
 
 /*---------------------------------------------------------------------------------*/
 
+void App_showAverageResult(void)
+{
+    /* Readings taken by the last tare/calibration average and the error reached */
+    HX711_AverageResult_t result;
+
+    hx711_getLastAverageResult(&result);
+
+    LCD_clearScreen();
+    LCD_displayStringRowColumn(0, 0, "Samples: ");
+    LCD_displayInteger(result.samples);
+    LCD_displayStringRowColumn(1, 0, "SE: ");
+    App_displayFloat((float)result.semMilligrams * 0.001f);
+    LCD_displayString(result.converged ? " g" : " g!");
+    _delay_ms(1000);
+}
+
+/*---------------------------------------------------------------------------------*/
+
+/*
+ * After a blocking average: if the HX711 stopped answering meanwhile, show
+ * the fault and return 1 so the caller abandons the step.
+ */
+uint8 App_checkScaleLost(void)
+{
+    uint8 faults = hx711_getFaults();
+
+    if (faults & HX711_FAULT_NO_DATA)
+    {
+        App_showScaleFault(faults);
+        _delay_ms(2000);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------*/
+
+void App_showScaleFault(uint8 faults)
+{
+    LCD_clearScreen();
+    LCD_displayStringRowColumn(0, 0, "Scale fault!");
+
+    if (faults & HX711_FAULT_NO_DATA)
+    {
+        LCD_displayStringRowColumn(1, 0, "No data");
+    }
+    else if (faults & HX711_FAULT_SATURATED)
+    {
+        LCD_displayStringRowColumn(1, 0, "Overload/open");
+    }
+    else if (faults & HX711_FAULT_NOISY)
+    {
+        LCD_displayStringRowColumn(1, 0, "Too noisy");
+    }
+    else
+    {
+        LCD_displayStringRowColumn(1, 0, "Check load cell");
+    }
+}
+
+/*---------------------------------------------------------------------------------*/
+
 uint8 App_validatePrice(float price)
 {
     return (price >= APPDATA_MIN_PRICE && price <= APPDATA_MAX_PRICE) ? 1 : 0;
@@ -997,6 +1265,9 @@ void performScaleCalibration(void)
      */
     double scale;
     int32_t offset;
+    int32_t scaleRecip;
+    double lowGainScale;
+    sint32 lowGainOffset;
     uint8_t key;
     double knownWeight = 1.0; // Use 1.000 kg calibration weight
 
@@ -1010,9 +1281,15 @@ void performScaleCalibration(void)
     {
         // Use library's calibration function
         hx711_calibrate1setoffset();
+        /* Empty-platform zero at gain 64 as well, for auto-ranging */
+        hx711_calibrateLowGainZero();
+        if (App_checkScaleLost())
+        {
+            return;
+        }
 
         App_showSuccess("Tare Done!");
-        _delay_ms(1000);
+        App_showAverageResult();
     }
 
     /* Step 2: Calibrate scale factor */
@@ -1025,13 +1302,27 @@ void performScaleCalibration(void)
     {
         // Use library's calibration function with known weight
         hx711_calibrate2setscale(knownWeight);
+        if (App_checkScaleLost())
+        {
+            return;
+        }
 
         App_showSuccess("Scale Calibrated!");
-        _delay_ms(1000);
+        App_showAverageResult();
         /* After calibration, save to EEPROM */
         scale = hx711_getscale();
         offset = hx711_getoffset();
-        if (AppData_saveCalibration(scale, offset) == APPDATA_NO_ERROR)
+        scaleRecip = hx711_getscalerecip();
+        /* Zero tracking stays bound to the new calibrated offset */
+        hx711_setZeroTrackingReference(offset);
+        /* Gain 64 was measured alongside (auto-ranging); clear a stale pair */
+        if (!hx711_getLowGainCalibration(&lowGainScale, &lowGainOffset))
+        {
+            lowGainScale = 0.0;
+            lowGainOffset = 0;
+        }
+        if (AppData_saveCalibration(scale, offset, scaleRecip) == APPDATA_NO_ERROR &&
+            AppData_saveLowGainCalibration(lowGainScale, lowGainOffset) == APPDATA_NO_ERROR)
         {
             App_showSuccess("Cal. Saved!");
         }
@@ -1039,1043 +1330,90 @@ void performScaleCalibration(void)
         {
             App_showError("Save Failed!");
         }
+
+        /* Step 3 (optional): more known weights for a multi-point curve */
+        hx711_clearCalibrationPoints();
+        hx711_addCalibrationPoint((sint32)(knownWeight * 1000.0));
+        performCalibrationPoints();
+    }
+}
+
+/*---------------------------------------------------------------------------------*/
+
+void performCalibrationPoints(void)
+{
+    /*
+     * Capture extra known weights (e.g. 2, 5 and 10 kg) so load-cell
+     * nonlinearity is corrected across the range, then persist the table.
+     * With only the 1.000 kg point the single scale stays in use.
+     */
+    char weightBuffer[MAX_PRICE_DIGITS + 1];
+    sint32 pointCounts[APPDATA_HX711_CAL_MAX_POINTS];
+    sint32 pointGrams[APPDATA_HX711_CAL_MAX_POINTS];
+    uint8 pointCount;
+    float knownKg;
+    uint8 key;
+
+    while (hx711_getCalibrationPoints(NULL, NULL) < APPDATA_HX711_CAL_MAX_POINTS)
+    {
+        LCD_clearScreen();
+        LCD_displayStringRowColumn(0, 0, "Add cal. point?");
+        LCD_displayStringRowColumn(1, 0, "#:Yes  *:Done");
+
+        key = KEYPAD_getPressedKey();
+        if (key != '#')
+        {
+            break;
+        }
+
+        LCD_clearScreen();
+        LCD_displayStringRowColumn(0, 0, "Known Wt (KG):");
+        LCD_displayStringRowColumn(1, 0, ">");
+        LCD_goToRowColumn(1, 1);
+
+        App_getNumericInput(weightBuffer, MAX_PRICE_DIGITS);
+        knownKg = App_parsePrice(weightBuffer);
+
+        LCD_clearScreen();
+        LCD_displayStringRowColumn(0, 0, "Place weight");
+        LCD_displayStringRowColumn(1, 0, "Press # to cal.");
+
+        key = KEYPAD_getPressedKey();
+        if (key != '#')
+        {
+            continue;
+        }
+
+        if (knownKg > 0.0f && hx711_addCalibrationPoint((sint32)(knownKg * 1000.0f + 0.5f)))
+        {
+            App_showSuccess("Point Added!");
+            App_showAverageResult();
+        }
+        else if (App_checkScaleLost())
+        {
+            return;
+        }
+        else
+        {
+            App_showError("Invalid Point!");
+        }
+    }
+
+    pointCount = hx711_getCalibrationPoints(pointCounts, pointGrams);
+
+    /* A lone 1.000 kg point adds nothing over the single scale */
+    if (pointCount < 2)
+    {
+        hx711_clearCalibrationPoints();
+        pointCount = 0;
+    }
+
+    if (AppData_saveCalibrationPoints(pointCounts, pointGrams, pointCount) == APPDATA_NO_ERROR)
+    {
+        App_showSuccess("Points Saved!");
+    }
+    else
+    {
+        App_showError("Save Failed!");
     }
 }
-=======
-/***********************************************************************************
- *                                                                                 *
- * [MODULE]: Application                                                           *
- *                                                                                 *
- * [FILE NAME]: main.c                                                             *
- *                                                                                 *
- * [DESCRIPTION]: Fruit weighing and pricing system with Admin/User roles         *
- *                                                                                 *
- ***********************************************************************************/
-
-/*---------------------------------------------------------------------------------*
- *                                   INCLUDES                                      *
- *---------------------------------------------------------------------------------*/
-#include "eeprom.h"
-#include "app_data.h"
-#include "keypad.h"
-#include "lcd.h"
-#include "hx711.h"
-
-
-/*---------------------------------------------------------------------------------*
- *                              GLOBAL CONST MACROS                                *
- *---------------------------------------------------------------------------------*/
-#define MAX_PASSWORD_LENGTH         6
-#define MAX_PRICE_DIGITS            8
-#define DECIMAL_PLACES              3
-
-/*---------------------------------------------------------------------------------*
- *                                     ENUMS                                       *
- *---------------------------------------------------------------------------------*/
-
-typedef enum
-{
-    STATE_ROLE_SELECT = 0,
-    STATE_ADMIN_LOGIN,
-    STATE_ADMIN_MENU,
-    STATE_UPDATE_PRICE,
-    STATE_UPDATE_PASSWORD,
-    STATE_VIEW_INCOME,
-    STATE_CALIBRATE_SCALE,
-    STATE_USER_BROWSE_ITEMS,
-    STATE_USER_WEIGH_ITEM,
-    STATE_USER_CHECKOUT,
-    STATE_LOGOUT
-} AppState_t;
-
-
-typedef enum
-{
-    ROLE_NONE = 0,
-    ROLE_ADMIN,
-    ROLE_USER
-} UserRole_t;
-
-/*---------------------------------------------------------------------------------*
- *                              GLOBAL VARIABLES                                   *
- *---------------------------------------------------------------------------------*/
-static AppState_t g_currentState = STATE_ROLE_SELECT;
-static UserRole_t g_currentRole = ROLE_NONE;
-static uint8 g_isAuthenticated = 0;
-static uint8 g_currentItemIndex = 1;
-static double g_sessionTotal = 0.0;
- sint32 g_moffset = 0;         // Tare offset
- double g_mscale = 1.0;        // Scale factor
-
-/*---------------------------------------------------------------------------------*
- *                              FUNCTION PROTOTYPES                                *
- *---------------------------------------------------------------------------------*/
-
-/* Initialization */
-void App_init(void);
-void App_displayWelcome(void);
-
-/* Role Selection */
-void App_handleRoleSelect(void);
-
-/* Admin Functions */
-void App_handleAdminLogin(void);
-void App_displayAdminMenu(void);
-void App_handleAdminMenu(void);
-void App_handleUpdatePrice(void);
-void App_handleUpdatePassword(void);
-void App_handleViewIncome(void);
-void performScaleCalibration(void);
-void App_handleCalibrateScale(void);
-
-/* User Functions */
-void App_handleUserBrowseItems(void);
-void App_handleUserWeighItem(void);
-void App_handleUserCheckout(void);
-
-/* Weight Measurement (Simulated) */
-float getWeight(void);
-
-/* Input Functions */
-void App_getPasswordInput(char* password, uint8 maxLength);
-void App_getNumericInput(char* buffer, uint8 maxLength);
-float App_parsePrice(const char* priceString);
-
-/* Display Helpers */
-void App_displayFloat(float value);
-void App_displayDouble(double value);
-void App_showMessage(const char* line1, const char* line2, uint16 delayMs);
-void App_showError(const char* message);
-void App_showSuccess(const char* message);
-
-/* Validation */
-uint8 App_validatePrice(float price);
-uint8 App_validatePassword(const char* password);
-uint8 App_validateItemIndex(uint8 index);
-
-/*---------------------------------------------------------------------------------*
- *                              FUNCTION DEFINITIONS                               *
- *---------------------------------------------------------------------------------*/
-
-int main(void)
-{
-    App_init();
-
-    while(1)
-    {
-        switch(g_currentState)
-        {
-            case STATE_ROLE_SELECT:
-                App_handleRoleSelect();
-                break;
-
-            case STATE_ADMIN_LOGIN:
-                App_handleAdminLogin();
-                break;
-
-            case STATE_ADMIN_MENU:
-                App_handleAdminMenu();
-                break;
-
-            case STATE_UPDATE_PRICE:
-                App_handleUpdatePrice();
-                break;
-
-            case STATE_UPDATE_PASSWORD:
-                App_handleUpdatePassword();
-                break;
-
-            case STATE_VIEW_INCOME:
-                App_handleViewIncome();
-                break;
-            case STATE_CALIBRATE_SCALE:
-                App_handleCalibrateScale();
-                break;
-            case STATE_USER_BROWSE_ITEMS:
-                App_handleUserBrowseItems();
-                break;
-
-            case STATE_USER_WEIGH_ITEM:
-                App_handleUserWeighItem();
-                break;
-
-            case STATE_USER_CHECKOUT:
-                App_handleUserCheckout();
-                break;
-
-            case STATE_LOGOUT:
-                g_isAuthenticated = 0;
-                g_currentRole = ROLE_NONE;
-                g_sessionTotal = 0.0;
-                g_currentState = STATE_ROLE_SELECT;
-                App_showMessage("Logged Out", "Thank you!", 2000);
-                break;
-
-            default:
-                g_currentState = STATE_ROLE_SELECT;
-                break;
-        }
-    }
-
-    return 0;
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_init(void)
-{
-    double saved_scale;
-    int32_t saved_offset;
-    EEPROM_Config_t eepromConfig;
-
-    LCD_init();
-    KEYPAD_init();
-    eepromConfig.mode = EEPROM_POLLING_MODE;
-    eepromConfig.programmingMode = EEPROM_ERASE_AND_WRITE_MODE;
-    eepromConfig.enableInterrupt = 0;
-    EEPROM_init(&eepromConfig);
-
-    AppData_init();
-    App_displayWelcome();
-    hx711_init(HX711_GAINCHANNELA128, g_mscale, g_moffset);
-}
-
-
-
-
-/*---------------------------------------------------------------------------------*/
-
-void App_displayWelcome(void)
-{
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Fruit Weighing");
-    LCD_displayStringRowColumn(1, 0, "   System v1.0");
-    _delay_ms(2000);
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_handleRoleSelect(void)
-{
-    uint8 key;
-
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Select Role:");
-    LCD_displayStringRowColumn(1, 0, "1:Admin  2:User");
-
-    key = KEYPAD_getPressedKey();
-
-    if(key == '1')
-    {
-        g_currentRole = ROLE_ADMIN;
-        g_currentState = STATE_ADMIN_LOGIN;
-    }
-    else if(key == '2')
-    {
-        g_currentRole = ROLE_USER;
-        g_currentItemIndex = 1;
-        g_sessionTotal = 0.0;
-        g_currentState = STATE_USER_BROWSE_ITEMS;
-    }
-    else
-    {
-        App_showError("Invalid Role!");
-    }
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_handleAdminLogin(void)
-{
-    char enteredPassword[MAX_PASSWORD_LENGTH + 1];
-    uint8 attempts = 3;
-
-    while(attempts > 0 && !g_isAuthenticated)
-    {
-        LCD_clearScreen();
-        LCD_displayStringRowColumn(0, 0, "Admin Login");
-        LCD_displayStringRowColumn(1, 0, "Attempts:");
-        LCD_displayInteger(attempts);
-        _delay_ms(1500);
-
-        LCD_clearScreen();
-        LCD_displayStringRowColumn(0, 0, "Password:");
-        LCD_goToRowColumn(1, 0);
-
-        App_getPasswordInput(enteredPassword, MAX_PASSWORD_LENGTH);
-
-        if(AppData_verifyPassword(enteredPassword))
-        {
-            g_isAuthenticated = 1;
-            g_currentState = STATE_ADMIN_MENU;
-            App_showSuccess("Access Granted!");
-        }
-        else
-        {
-            attempts--;
-            if(attempts > 0)
-            {
-                App_showError("Wrong Password!");
-            }
-            else
-            {
-                App_showMessage("System Locked!", "Please wait...", 5000);
-                g_currentState = STATE_ROLE_SELECT;
-            }
-        }
-    }
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_displayAdminMenu(void)
-{
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "1:Price 2:Pass");
-    LCD_displayStringRowColumn(1, 0, "3:$ 4:Cal 0:Out");
-}
-
-/*---------------------------------------------------------------------------------*/
-
-/*---------------------------------------------------------------------------------*/
-void App_handleAdminMenu(void)
-{
-    uint8 key;
-
-    App_displayAdminMenu();
-
-    key = KEYPAD_getPressedKey();
-
-    switch(key)
-    {
-        case 'A':
-        case 'a':
-        case '1':
-            g_currentState = STATE_UPDATE_PRICE;
-            break;
-
-        case 'B':
-        case 'b':
-        case '2':
-            g_currentState = STATE_UPDATE_PASSWORD;
-            break;
-
-        case 'C':
-        case 'c':
-        case '3':
-            g_currentState = STATE_VIEW_INCOME;
-            break;
-
-        case 'D':
-        case 'd':
-        case '4':
-            g_currentState = STATE_CALIBRATE_SCALE;  /* NEW */
-            break;
-
-        case '0':
-            g_currentState = STATE_LOGOUT;
-            break;
-
-        default:
-            App_showError("Invalid Option!");
-            break;
-    }
-}
-
-void App_handleUserBrowseItems(void)
-{
-    char itemName[17];
-    float itemPrice;
-    uint8 key;
-
-    /* Load current item data */
-    AppData_loadItemName(g_currentItemIndex, itemName);
-    itemPrice = AppData_loadItemPrice(g_currentItemIndex);
-
-    /* Display item */
-    LCD_clearScreen();
-    LCD_goToRowColumn(0,0);
-    LCD_displayInteger(g_currentItemIndex);
-    LCD_displayStringRowColumn(0, 1, ". ");
-    LCD_displayStringRowColumn(0, 3, itemName);
-    LCD_goToRowColumn(1, 0);
-    LCD_displayString("$");
-    App_displayFloat(itemPrice);
-    LCD_displayString("/KG");
-
-    _delay_ms(500);
-
-    /* Wait for user input */
-    key = KEYPAD_getPressedKey();
-
-    if(key == '#')  /* Select this item */
-    {
-        g_currentState = STATE_USER_WEIGH_ITEM;
-    }
-    else if(key == 'A')  /* Next item */
-    {
-        g_currentItemIndex++;
-        if(g_currentItemIndex > APPDATA_NUM_ITEMS)
-        {
-            g_currentItemIndex = 1;
-        }
-    }
-    else if(key == 'B')  /* Previous item */
-    {
-        g_currentItemIndex--;
-        if(g_currentItemIndex < 1)
-        {
-            g_currentItemIndex = APPDATA_NUM_ITEMS;
-        }
-    }
-    else if(key == 'D')  /* Checkout */
-    {
-        if(g_sessionTotal > 0.0)
-        {
-            g_currentState = STATE_USER_CHECKOUT;
-        }
-        else
-        {
-            App_showMessage("Cart Empty!", "Add items first", 2000);
-        }
-    }
-    else if(key == 'C')  /* Cancel/Exit */
-    {
-        if(g_sessionTotal > 0.0)
-        {
-            LCD_clearScreen();
-            LCD_displayStringRowColumn(0, 0, "Cancel order?");
-            LCD_displayStringRowColumn(1, 0, "1:Yes  0:No");
-
-            key = KEYPAD_getPressedKey();
-            if(key == '1')
-            {
-                g_sessionTotal = 0.0;
-                g_currentState = STATE_ROLE_SELECT;
-            }
-        }
-        else
-        {
-            g_currentState = STATE_ROLE_SELECT;
-        }
-    }
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_handleUserWeighItem(void)
-{
-    float weight;
-    float unitPrice;
-    float itemTotal;
-    char itemName[17];
-    uint8 key;
-
-    /* Get item data */
-    AppData_loadItemName(g_currentItemIndex, itemName);
-    unitPrice = AppData_loadItemPrice(g_currentItemIndex);
-
-
-    /* Step 3: Ask to place weight */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Place weight");
-    LCD_displayStringRowColumn(1, 0, "then press #");
-    _delay_ms(500);
-    hx711_startSimulationPattern();
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Weight:");
-    /* Step 4: Show real-time weight */
-    while(1)
-    {
-        weight = getWeight();
-        _delay_ms(100);
-
-        LCD_goToRowColumn(1, 0);
-        App_displayFloat(weight);
-        LCD_displayString(" kg");
-        /* Check for confirmation */
-        key = KEYPAD_getPressedKeyNonBlocking();
-        if(key == '#')
-        {
-            break;
-        }
-        else if(key == '*')  /* Cancel */
-        {
-            g_currentState = STATE_ROLE_SELECT;
-            return;
-        }
-    }
-
-    /* Step 5: Calculate price */
-    itemTotal = weight * unitPrice;
-    g_sessionTotal += (double)itemTotal;
-
-    /* Display item total */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, itemName);
-    LCD_goToRowColumn(1, 0);
-    LCD_displayString("$");
-    App_displayFloat(itemTotal);
-    _delay_ms(2000);
-
-    /* Step 6: Ask for another item */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Add another?");
-    LCD_displayStringRowColumn(1, 0, "1:Yes  0:No");
-
-    key = KEYPAD_getPressedKey();
-
-    if(key == '1')
-    {
-        g_currentState = STATE_USER_BROWSE_ITEMS;
-    }
-    else if(key == '0')
-    {
-        g_currentState = STATE_USER_CHECKOUT;
-    }
-
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_handleUserCheckout(void)
-{
-    uint8 key;
-
-    /* Display total */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Total Amount:");
-    LCD_goToRowColumn(1, 0);
-    LCD_displayString("$");
-    App_displayDouble(g_sessionTotal);
-    _delay_ms(3000);
-
-    /* Ask for confirmation */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Confirm payment?");
-    LCD_displayStringRowColumn(1, 0, "1:Yes  0:Cancel");
-
-    key = KEYPAD_getPressedKey();
-
-    if(key == '1')
-    {
-        /* Add to total income */
-        if(AppData_addToTotalIncome(g_sessionTotal) == APPDATA_NO_ERROR)
-        {
-            App_showSuccess("Payment Done!");
-
-            /* Display receipt */
-            LCD_clearScreen();
-            LCD_displayStringRowColumn(0, 0, "Thank you!");
-            LCD_displayStringRowColumn(1, 0, "Have a nice day");
-            _delay_ms(3000);
-
-            /* Reset session */
-            g_sessionTotal = 0.0;
-            g_currentState = STATE_ROLE_SELECT;
-        }
-        else
-        {
-            App_showError("Payment Failed!");
-            g_currentState = STATE_USER_BROWSE_ITEMS;
-        }
-    }
-    else if(key==0)
-    {
-        App_showMessage("Cancelled", "Returning...", 1000);
-        g_currentState = STATE_ROLE_SELECT;
-    }
-}
-
-/*---------------------------------------------------------------------------------*/
-
-/*---------------------------------------------------------------------------------
- * Weight Measurement Functions - HX711 Implementation
- *---------------------------------------------------------------------------------*/
-
-float getWeight(void)
-{
-    /*
-     * Read weight from HX711 in kilograms
-     * Uses the library's built-in calibrated reading
-     */
-
-    double weight_kg;
-
-    // Get weight using library function (returns calibrated value)
-    weight_kg = hx711_getweight();
-
-    // Ensure non-negative weight
-    if(weight_kg < 0.000) {
-        weight_kg = 0.000;
-    }
-
-    return (float)weight_kg;
-}
-
-/*---------------------------------------------------------------------------------*/
-
-/* Keep all the Admin functions from previous version */
-void App_handleUpdatePrice(void)
-{
-    char indexBuffer[2];
-    char priceBuffer[MAX_PRICE_DIGITS + 1];
-    uint8 itemIndex;
-    float newPrice;
-    float currentPrice;
-
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Update Price/KG");
-    _delay_ms(1000);
-
-    /* Get item index */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Item (1-5):");
-    LCD_goToRowColumn(1, 0);
-
-    indexBuffer[0] = KEYPAD_getPressedKey();
-    indexBuffer[1] = '\0';
-    LCD_displayCharacter(indexBuffer[0]);
-
-    itemIndex = atoi(indexBuffer);
-
-    if(!App_validateItemIndex(itemIndex))
-    {
-        App_showError("Invalid Index!");
-        g_currentState = STATE_ADMIN_MENU;
-        return;
-    }
-
-    /* Display current price */
-    currentPrice = AppData_loadItemPrice(itemIndex);
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Current:$/KG");
-    LCD_goToRowColumn(1, 0);
-    App_displayFloat(currentPrice);
-    _delay_ms(2000);
-
-    /* Get new price */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "New Price/KG:");
-    LCD_displayStringRowColumn(1, 0, "$");
-    LCD_goToRowColumn(1, 1);
-
-    App_getNumericInput(priceBuffer, MAX_PRICE_DIGITS);
-    newPrice = App_parsePrice(priceBuffer);
-
-    if(!App_validatePrice(newPrice))
-    {
-        App_showError("Invalid Price!");
-        g_currentState = STATE_ADMIN_MENU;
-        return;
-    }
-
-    /* Save new price */
-    if(AppData_saveItemPrice(itemIndex, newPrice) == APPDATA_NO_ERROR)
-    {
-        App_showSuccess("Price Updated!");
-    }
-    else
-    {
-        App_showError("Update Failed!");
-    }
-
-    g_currentState = STATE_ADMIN_MENU;
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_handleUpdatePassword(void)
-{
-    char currentPassword[MAX_PASSWORD_LENGTH + 1];
-    char newPassword[MAX_PASSWORD_LENGTH + 1];
-    char confirmPassword[MAX_PASSWORD_LENGTH + 1];
-
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Verify Identity");
-    _delay_ms(1000);
-
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Password:");
-    LCD_goToRowColumn(1, 0);
-
-    App_getPasswordInput(currentPassword, MAX_PASSWORD_LENGTH);
-
-    if(!AppData_verifyPassword(currentPassword))
-    {
-        App_showError("Wrong Password!");
-        g_currentState = STATE_ADMIN_MENU;
-        return;
-    }
-
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "New Password:");
-    LCD_goToRowColumn(1, 0);
-
-    App_getPasswordInput(newPassword, MAX_PASSWORD_LENGTH);
-
-    if(!App_validatePassword(newPassword))
-    {
-        App_showError("Invalid Format!");
-        g_currentState = STATE_ADMIN_MENU;
-        return;
-    }
-
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Confirm:");
-    LCD_goToRowColumn(1, 0);
-
-    App_getPasswordInput(confirmPassword, MAX_PASSWORD_LENGTH);
-
-    if(strcmp(newPassword, confirmPassword) != 0)
-    {
-        App_showError("Not Matching!");
-        g_currentState = STATE_ADMIN_MENU;
-        return;
-    }
-
-    if(AppData_savePassword(newPassword) == APPDATA_NO_ERROR)
-    {
-        App_showSuccess("Password Changed!");
-    }
-    else
-    {
-        App_showError("Update Failed!");
-    }
-
-    g_currentState = STATE_ADMIN_MENU;
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_handleViewIncome(void)
-{
-    double totalIncome;
-    uint8 key;
-
-    totalIncome = AppData_loadTotalIncome();
-
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Total Income:");
-    LCD_goToRowColumn(1, 0);
-    LCD_displayString("$");
-    App_displayDouble(totalIncome);
-    _delay_ms(3000);
-
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Reset Income?");
-    LCD_displayStringRowColumn(1, 0, "1:Yes  0:No");
-
-    key = KEYPAD_getPressedKey();
-
-    if(key == '1')
-    {
-        LCD_clearScreen();
-        LCD_displayStringRowColumn(0, 0, "Are you sure?");
-        LCD_displayStringRowColumn(1, 0, "1:Yes  0:No");
-
-        key = KEYPAD_getPressedKey();
-
-        if(key == '1')
-        {
-            if(AppData_saveTotalIncome(0.0) == APPDATA_NO_ERROR)
-            {
-                App_showSuccess("Income Reset!");
-            }
-            else
-            {
-                App_showError("Reset Failed!");
-            }
-        }
-    }
-
-    g_currentState = STATE_ADMIN_MENU;
-}
-
-/*---------------------------------------------------------------------------------*/
-void App_handleCalibrateScale(void)
-{
-    uint8 key;
-    /* Display calibration intro */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Scale Calibrate");
-    LCD_displayStringRowColumn(1, 0, "Press # to start");
-
-    key = KEYPAD_getPressedKey();
-    if(key != '#') {
-        g_currentState = STATE_ADMIN_MENU;
-        return;
-    }
-    performScaleCalibration();
-    /* Return to admin menu */
-    g_currentState = STATE_ADMIN_MENU;
-}
-
-/*---------------------------------------------------------------------------------*/
-
-/* Keep all helper functions from previous version */
-void App_getPasswordInput(char* password, uint8 maxLength)
-{
-    uint8 index = 0;
-    uint8 key;
-
-    while(index < maxLength)
-    {
-        key = KEYPAD_getPressedKey();
-
-        if(key == '#')
-        {
-            break;
-        }
-        else if(key == '*')
-        {
-            if(index > 0)
-            {
-                index--;
-                LCD_goToRowColumn(1, index);
-                LCD_displayCharacter(' ');
-                LCD_goToRowColumn(1, index);
-            }
-        }
-        else if(key >= '0' && key <= '9')
-        {
-            password[index] = key;
-            LCD_displayCharacter('*');
-            index++;
-        }
-    }
-
-    password[index] = '\0';
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_getNumericInput(char* buffer, uint8 maxLength)
-{
-    uint8 index = 0;
-    uint8 key;
-    uint8 hasDecimal = 0;
-    uint8 decimalCount = 0;
-
-    while(index < maxLength)
-    {
-        key = KEYPAD_getPressedKey();
-
-        if(key == '#')
-        {
-            break;
-        }
-        else if(key == '*')
-        {
-            if(index > 0)
-            {
-                index--;
-                if(buffer[index] == '.')
-                {
-                    hasDecimal = 0;
-                    decimalCount = 0;
-                }
-                else if(hasDecimal)
-                {
-                    decimalCount--;
-                }
-                LCD_goToRowColumn(1, index + 1);
-                LCD_displayCharacter(' ');
-                LCD_goToRowColumn(1, index + 1);
-            }
-        }
-        else if(key >= '0' && key <= '9')
-        {
-            if(hasDecimal && decimalCount >= DECIMAL_PLACES)
-            {
-                continue;
-            }
-
-            buffer[index] = key;
-            LCD_displayCharacter(key);
-            index++;
-
-            if(hasDecimal)
-            {
-                decimalCount++;
-            }
-        }
-        else if(key == 'D' && !hasDecimal && index > 0)
-        {
-            buffer[index] = '.';
-            LCD_displayCharacter('.');
-            index++;
-            hasDecimal = 1;
-        }
-    }
-
-    buffer[index] = '\0';
-}
-
-/*---------------------------------------------------------------------------------*/
-
-float App_parsePrice(const char* priceString)
-{
-    return atof(priceString);
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_displayFloat(float value)
-{
-    char buffer[16];
-    uint8 i;
-
-    dtostrf(value, 6, DECIMAL_PLACES, buffer);
-
-    i = 0;
-    while(buffer[i] == ' ')
-    {
-        i++;
-    }
-
-    LCD_displayString(&buffer[i]);
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_displayDouble(double value)
-{
-    char buffer[32];
-    uint8 i;
-
-    dtostrf(value, 10, DECIMAL_PLACES, buffer);
-
-    i = 0;
-    while(buffer[i] == ' ')
-    {
-        i++;
-    }
-
-    LCD_displayString(&buffer[i]);
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_showMessage(const char* line1, const char* line2, uint16 delayMs)
-{
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, line1);
-
-    if(line2 != NULL && strlen(line2) > 0)
-    {
-        LCD_displayStringRowColumn(1, 0, line2);
-    }
-
-    _delay_ms(delayMs);
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_showError(const char* message)
-{
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "ERROR!");
-    LCD_displayStringRowColumn(1, 0, message);
-    _delay_ms(2000);
-}
-
-/*---------------------------------------------------------------------------------*/
-
-void App_showSuccess(const char* message)
-{
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "SUCCESS!");
-    LCD_displayStringRowColumn(1, 0, message);
-    _delay_ms(2000);
-}
-
-/*---------------------------------------------------------------------------------*/
-
-uint8 App_validatePrice(float price)
-{
-    return (price >= APPDATA_MIN_PRICE && price <= APPDATA_MAX_PRICE) ? 1 : 0;
-}
-
-/*---------------------------------------------------------------------------------*/
-
-uint8 App_validatePassword(const char* password)
-{
-    uint8 length = strlen(password);
-    uint8 i;
-
-    if(length < 4 || length > MAX_PASSWORD_LENGTH)
-    {
-        return 0;
-    }
-
-    for(i = 0; i < length; i++)
-    {
-        if(password[i] < '0' || password[i] > '9')
-        {
-            return 0;
-        }
-    }
-
-    return 1;
-}
-
-/*---------------------------------------------------------------------------------*/
-
-uint8 App_validateItemIndex(uint8 index)
-{
-    return (index >= 1 && index <= APPDATA_NUM_ITEMS) ? 1 : 0;
-}
-
-/*---------------------------------------------------------------------------------*/
-void performScaleCalibration(void)
-{
-    /*
-     * Two-step calibration process for your HX711 load cell
-     * This should be done ONCE during initial setup
-     */
-	double scale;
-	int32_t offset;
-    uint8_t key;
-    double knownWeight = 1.0;  // Use 1.000 kg calibration weight
-
-    /* Step 1: Calibrate offset (tare) */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Remove weight");
-    LCD_displayStringRowColumn(1, 0, "Press # to tare");
-
-    key = KEYPAD_getPressedKey();
-    if(key == '#') {
-        // Use library's calibration function
-        hx711_calibrate1setoffset();
-
-        App_showSuccess("Tare Done!");
-        _delay_ms(1000);
-    }
-
-    /* Step 2: Calibrate scale factor */
-    LCD_clearScreen();
-    LCD_displayStringRowColumn(0, 0, "Place 1.000 KG");
-    LCD_displayStringRowColumn(1, 0, "Press # to cal.");
-
-    key = KEYPAD_getPressedKey();
-    if(key == '#') {
-        // Use library's calibration function with known weight
-        hx711_calibrate2setscale(knownWeight);
-
-        App_showSuccess("Scale Calibrated!");
-        _delay_ms(1000);
-        /* After calibration, save to EEPROM */
-        scale = hx711_getscale();
-        offset = hx711_getoffset();
-        g_moffset=offset;
-        g_mscale=scale;
-        if(AppData_saveCalibration(scale, offset) == APPDATA_NO_ERROR) {
-            App_showSuccess("Cal. Saved!");
-        } else {
-           App_showError("Save Failed!");
-        }
-    }
-}
-
->>>>>>> edc6387c1d585a5baaf460e549f88eece77f0548
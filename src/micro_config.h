@@ -1,4 +1,3 @@
-<<<<<<< HEAD
  /******************************************************************************
  *
  * Module: Micro - Configuration
@@ -26,32 +25,3 @@
 
 
 #endif /* MICRO_CONFIG_H_ */
-=======
- /******************************************************************************
- *
- * Module: Micro - Configuration
- *
- * File Name: Micro_Config.h
- *
- * Description: File include all Microcontroller libraries
- *
- * 
- *
- *******************************************************************************/
-
-#ifndef MICRO_CONFIG_H_
-#define MICRO_CONFIG_H_
-
-#ifndef F_CPU
-#define F_CPU 1000000UL //1MHz Clock frequency
-#endif  
-#define SIMULATION_MODE 1
-
-#include <avr/io.h>
-#include <avr/interrupt.h>
-#include <util/delay.h>
-#include <stdlib.h>
-
-
-#endif /* MICRO_CONFIG_H_ */
->>>>>>> edc6387c1d585a5baaf460e549f88eece77f0548